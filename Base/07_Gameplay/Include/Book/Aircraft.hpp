@@ -9,13 +9,8 @@
 #include <SFML/Window/Mouse.hpp>
 #include <SFML\Window\Event.hpp>
 
-#include <SFML/Graphics/Sprite.hpp>
 #include <SFML/Graphics/View.hpp>
 
-namespace sf
-{
-	class RenderWindow;
-}
 
 class Aircraft : public Entity
 {
@@ -35,10 +30,9 @@ class Aircraft : public Entity
 		};
 
 	public:
-								Aircraft(Type type, const TextureHolder& textures, const FontHolder& fonts, sf::RenderWindow& window, unsigned int difficulty);
+								Aircraft(Type type, const TextureHolder& textures, const FontHolder& fonts, EntityRegistry& registry, unsigned int difficulty);
 
 		virtual unsigned int	getCategory() const;
-		virtual sf::FloatRect	getBoundingRect() const;
 		virtual bool 			isMarkedForRemoval() const;
 		bool					isAllied() const;
 		float					getMaxSpeed() const;
@@ -54,7 +48,7 @@ class Aircraft : public Entity
 		
 		void					playLocalSound(CommandQueue& commands, SoundEffect::ID effect);
 		
-		void					setSeek();
+		void					setSeek(sf::Vector2i target);
 		void					seekTarget(sf::Vector2f pos, sf::Vector2f targetPos);
 		void					stopSeek();
 		bool					isSeek() const;
@@ -65,50 +59,35 @@ class Aircraft : public Entity
 		bool					isStick();
 
 	private:
-		virtual void			drawCurrent(sf::RenderTarget& target, sf::RenderStates states) const;
 		virtual void 			updateCurrent(sf::Time dt, CommandQueue& commands);
-		void					updateMovementPattern(sf::Time dt);
 		void					checkPickupDrop(CommandQueue& commands);
 		void					checkProjectileLaunch(sf::Time dt, CommandQueue& commands);
 
-		void					createBullets(SceneNode& node, const TextureHolder& textures) const;
-		void					createProjectile(SceneNode& node, Projectile::Type type, float xOffset, float yOffset, const TextureHolder& textures) const;
-		void					createPickup(SceneNode& node, const TextureHolder& textures) const;
+		Command					makeProjectileCommand(Projectile::Type type) const;
+		void					createBullets(SceneNode& node) const;
+		void					createProjectile(SceneNode& node, Projectile::Type type, float xOffset, float yOffset) const;
+		void					createPickup(SceneNode& node) const;
 
+		Components::Weapon&		getWeapon();
+		const Components::Weapon&	getWeapon() const;
 		void					updateTexts();
 
 
 	private:
 		Type					mType;
 		Seek					mSeek;
-		sf::Sprite				mSprite;
-		Command 				mFireCommand;
-		Command					mMissileCommand;
-		Command					mEnergyCommand;
-		sf::Time				mFireCountdown;
-		bool 					mIsFiring;
-		bool					mIsLaunchingMissile;
-		bool					mIsLaunchingEnergy;
+		const TextureHolder&	mTextures;
 		bool 					mIsMarkedForRemoval;
 		bool					mPlayedExplosionSound;
 		
 		int						mDifficulty;
-		int						mFireRateLevel;
-		int						mSpreadLevel;
-		int						mMissileAmmo;
-		int						mEnergy;
-
-		Command 				mDropPickupCommand;
-		float					mTravelledDistance;
-		std::size_t				mDirectionIndex;
+
 		TextNode*				mHealthDisplay;
 		TextNode*				mMissileDisplay;
 		TextNode*				mEnergyDisplay;
 
 		float					mSeekRadius;
 
-		sf::RenderWindow&		mWindow;
-
 		sf::Vector2f			mStickDirection;
 		float					mStickSensitivity;
 };
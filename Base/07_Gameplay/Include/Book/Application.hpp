@@ -2,13 +2,22 @@
 #define BOOK_APPLICATION_HPP
 
 #include <Book/ResourceHolder.hpp>
+#include <Book/ResourceBudget.hpp>
+#include <Book/LoadTimeline.hpp>
+#include <Book/AssetPack.hpp>
 #include <Book/ResourceIdentifiers.hpp>
 #include <Book/Player.hpp>
 #include <Book/StateStack.hpp>
 #include <Book/MusicPlayer.hpp>
 #include <Book/SoundPlayer.hpp>
+#include <Book/Profiler.hpp>
+#include <Book/Settings.hpp>
+#include <Book/RenderStatistics.hpp>
+#include <Book/QualityGovernor.hpp>
+#include <Book/ResolutionScaler.hpp>
 
 #include <SFML/System/Time.hpp>
+#include <SFML/System/Clock.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
 #include <SFML/Graphics/Text.hpp>
 
@@ -23,27 +32,51 @@ class Application
 	private:
 		void					processInput();
 		void					update(sf::Time dt);
-		void					render();
+		bool					render(float interpolation);
 
+		// untilNextTick: how long nothing can change if the frame wasn't drawn, zero if it was
+		void					waitForNextFrame(sf::Time untilNextTick);
 		void					updateStatistics(sf::Time dt);
+		void					updateQuality(sf::Time frameTime);
 		void					registerStates();
 
 
 	private:
-		static const sf::Time	TimePerFrame;
+		static const std::size_t	MaxTicksPerFrame;
+		static const sf::Time	SpinThreshold;
+		static const sf::Time	BackgroundTimePerRender;
+		static const std::size_t	TextureBudgetBytes;
 
+		// First member, so the startup timeline covers everything constructed after it
+		LoadTimeline			mLoadTimeline;
+		// Mapped for the whole run: resources created from it keep pointing into it
+		AssetPack				mAssetPack;
 		sf::RenderWindow		mWindow;
+		// Declared before all texture holders, which unregister from it when destroyed
+		ResourceBudget			mTextureBudget;
 		TextureHolder			mTextures;
 	  	FontHolder				mFonts;
 		Player					mPlayer;
 		
 		MusicPlayer				mMusic;
 		SoundPlayer				mSounds;
+		Profiler				mProfiler;
+		Settings				mSettings;
+		RenderStatistics		mRenderStatistics;
+		QualityGovernor			mQualityGovernor;
+		ResolutionScaler		mResolutionScaler;
 		StateStack				mStateStack;
 
+		bool					mHasFocus;
+		sf::Clock				mPacingClock;
+		sf::Time				mFrameDeadline;
+
 		sf::Text				mStatisticsText;
 		sf::Time				mStatisticsUpdateTime;
 		std::size_t				mStatisticsNumFrames;
+		sf::Time				mStatisticsIdleTime;
+
+		bool					mRedrawRequested;
 };
 
 #endif // BOOK_APPLICATION_HPP
@@ -0,0 +1,74 @@
+#ifndef BOOK_ASSETPACK_HPP
+#define BOOK_ASSETPACK_HPP
+
+#include <Book/MappedFile.hpp>
+#include <Book/ResourceIdentifiers.hpp>
+
+#include <SFML/Config.hpp>
+#include <SFML/System/NonCopyable.hpp>
+
+#include <string>
+#include <vector>
+
+
+// All assets in one file: a header, a table of (kind, ID) -> (offset, size) sorted by kind
+// and ID, then the contents. The pack is memory-mapped, and resources are created from the
+// mapped bytes, so nothing is copied on the way. Textures are baked already decoded, as a
+// TextureHeader followed by RGBA rows, and uploaded straight from the mapping; other assets
+// are stored as their files and opened with loadFromMemory().
+class AssetPack : private sf::NonCopyable
+{
+	public:
+		struct Source
+		{
+			Assets::Kind			kind;
+			unsigned int			id;
+			std::string				filename;
+		};
+
+
+		// In front of the pixels of a texture; 16 bytes, so the rows stay aligned
+		struct TextureHeader
+		{
+			sf::Uint32				width;
+			sf::Uint32				height;
+			sf::Uint32				reserved[2];
+		};
+
+
+	public:
+		// Without a valid pack at the given path, find() fails and loose files are used
+		explicit					AssetPack(const std::string& filename);
+
+		bool						isOpen() const;
+		bool						find(Assets::Kind kind, unsigned int id, const void*& data, std::size_t& size) const;
+
+		// Used by the pack baker
+		static bool					write(const std::string& filename, const std::vector<Source>& sources);
+
+
+	private:
+		struct Header
+		{
+			char					magic[4];
+			sf::Uint32				version;
+			sf::Uint32				entryCount;
+			sf::Uint32				reserved;
+		};
+
+		struct Entry
+		{
+			sf::Uint32				kind;
+			sf::Uint32				id;
+			sf::Uint64				offset;
+			sf::Uint64				size;
+		};
+
+
+	private:
+		MappedFile					mFile;
+		const Entry*				mEntries;
+		std::size_t					mEntryCount;
+};
+
+#endif // BOOK_ASSETPACK_HPP
@@ -0,0 +1,48 @@
+#ifndef BOOK_BOUNDINGBOXARRAY_HPP
+#define BOOK_BOUNDINGBOXARRAY_HPP
+
+#include <SFML/Graphics/Rect.hpp>
+
+#include <vector>
+#include <cstddef>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define BOOK_USE_SSE2
+#endif
+
+
+// Collider boxes of one tick, stored per coordinate so that one box can be
+// tested against BatchSize others at once. The arrays are padded with boxes
+// that interact with nothing, so a batch may start at any valid index.
+class BoundingBoxArray
+{
+	public:
+		static const std::size_t	BatchSize = 4;
+
+
+	public:
+									BoundingBoxArray();
+
+		void						resize(std::size_t count);
+		void						set(std::size_t index, const sf::FloatRect& bounds, unsigned int category, unsigned int mask);
+
+		std::size_t					size() const;
+		sf::FloatRect				getRect(std::size_t index) const;
+		unsigned int				getCategory(std::size_t index) const;
+		unsigned int				getMask(std::size_t index) const;
+
+		// Bit k is set if box index interacts with and overlaps box first + k
+		unsigned int				overlapBatch(std::size_t index, std::size_t first) const;
+
+
+	private:
+		std::size_t					mCount;
+		std::vector<float>			mLeft;
+		std::vector<float>			mTop;
+		std::vector<float>			mRight;
+		std::vector<float>			mBottom;
+		std::vector<unsigned int>	mCategories;
+		std::vector<unsigned int>	mMasks;
+};
+
+#endif // BOOK_BOUNDINGBOXARRAY_HPP
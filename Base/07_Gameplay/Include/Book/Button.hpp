@@ -49,7 +49,7 @@ class Button : public Component
 
 
     private:
-        virtual void			draw(sf::RenderTarget& target, sf::RenderStates states) const;
+        virtual void			drawCounted(CountingTarget& target, sf::RenderStates states) const;
 
 
     private:
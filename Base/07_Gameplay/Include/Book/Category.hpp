@@ -15,7 +15,6 @@ namespace Category
 		Pickup				= 1 << 4,
 		AlliedProjectile	= 1 << 5,
 		EnemyProjectile		= 1 << 6,
-		SoundEffect			= 1 << 8,
 
 		Aircraft = PlayerAircraft | AlliedAircraft | EnemyAircraft,
 		Projectile = AlliedProjectile | EnemyProjectile,
@@ -0,0 +1,30 @@
+#ifndef BOOK_COLLISION_HPP
+#define BOOK_COLLISION_HPP
+
+
+class Entity;
+class CommandQueue;
+
+// Which categories interact, and how they respond to each other
+namespace Collision
+{
+	typedef void (*Response)(Entity& first, Entity& second, CommandQueue& commands);
+
+	struct Contact
+	{
+		Entity*				first;
+		Entity*				second;
+		Response			response;
+	};
+
+	// Categories that a collider of the given category can collide with
+	unsigned int			getMask(unsigned int category);
+
+	// True for fast movers, which are tested along their path of the whole tick instead of at its end
+	bool					isSwept(unsigned int category);
+
+	// Orders the pair as the response expects it; the categories must collide according to getMask()
+	Contact					makeContact(Entity& lhs, unsigned int lhsCategory, Entity& rhs, unsigned int rhsCategory);
+}
+
+#endif // BOOK_COLLISION_HPP
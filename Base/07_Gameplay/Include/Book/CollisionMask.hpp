@@ -0,0 +1,53 @@
+#ifndef BOOK_COLLISIONMASK_HPP
+#define BOOK_COLLISIONMASK_HPP
+
+#include <SFML/Config.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <vector>
+#include <cstddef>
+
+
+namespace sf
+{
+	class Image;
+}
+
+// Pixel-exact collision shape of a texture, built once from its alpha channel.
+// The shape is precomputed for a fixed number of rotations; each variant is a
+// bit grid aligned with the world axes, 64 pixels per word.
+class CollisionMask
+{
+	public:
+		static const std::size_t	RotationSteps = 32;
+
+
+	public:
+		explicit					CollisionMask(const sf::Image& image);
+
+		// True if both textures, centered at the given positions and rotated by the given angles, share an opaque pixel
+		static bool					overlap(const CollisionMask& lhs, sf::Vector2f lhsCenter, float lhsRotation,
+										const CollisionMask& rhs, sf::Vector2f rhsCenter, float rhsRotation);
+
+
+	private:
+		struct Shape
+		{
+			sf::Vector2i			offset;
+			int						width;
+			int						height;
+			int						wordsPerRow;
+			std::vector<sf::Uint64>	bits;
+		};
+
+
+	private:
+		static Shape				buildShape(const sf::Image& image, float rotation);
+		const Shape&				getShape(float rotation) const;
+
+
+	private:
+		std::vector<Shape>			mShapes;
+};
+
+#endif // BOOK_COLLISIONMASK_HPP
@@ -2,6 +2,7 @@
 #define BOOK_COMMANDQUEUE_HPP
 
 #include <Book/Command.hpp>
+#include <Book/SoundEventBuffer.hpp>
 
 #include <queue>
 
@@ -13,9 +14,13 @@ class CommandQueue
 		Command						pop();
 		bool						isEmpty() const;
 
+		// Sound effects requested this tick, played by the level without walking the scene graph
+		SoundEventBuffer&			getSoundEvents();
+
 		
 	private:
 		std::queue<Command>			mQueue;
+		SoundEventBuffer			mSoundEvents;
 };
 
 #endif // BOOK_COMMANDQUEUE_HPP
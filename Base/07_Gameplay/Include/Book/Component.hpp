@@ -16,6 +16,8 @@ namespace sf
 	class Event;
 }
 
+class CountingTarget;
+
 namespace GUI
 {
 
@@ -41,9 +43,23 @@ class Component : public sf::Drawable, public sf::Transformable, private sf::Non
         virtual void		handleEvent(const sf::Event& event) = 0;
 		virtual bool		checkWorldBounds() = 0;
 
+		// Draws through the counting target, so the statistics see each drawable the component is made of
+		virtual void		drawCounted(CountingTarget& target, sf::RenderStates states) const = 0;
+
+	protected:
+		// Called when the component looks different, so that the container redraws its cached image
+		virtual void		requestRedraw();
+
     private:
+		// Draws to a plain target are passed on uncounted
+		virtual void		draw(sf::RenderTarget& target, sf::RenderStates states) const;
+
+    private:
+		friend class		Container;
+
         bool				mIsSelected;
         bool				mIsActive;
+		Component*			mParent;
 };
 
 }
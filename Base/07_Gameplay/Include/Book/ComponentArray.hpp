@@ -0,0 +1,42 @@
+#ifndef BOOK_COMPONENTARRAY_HPP
+#define BOOK_COMPONENTARRAY_HPP
+
+#include <vector>
+#include <cstddef>
+#include <cassert>
+
+
+// Densely packed storage for one component type, indexed by entity ID.
+// Removal swaps the last element into the freed slot, so iteration over
+// the dense range never touches holes.
+template <typename Component>
+class ComponentArray
+{
+	public:
+		typedef std::size_t			ID;
+
+
+	public:
+		void						insert(ID id, const Component& component);
+		void						remove(ID id);
+		bool						contains(ID id) const;
+
+		Component&					get(ID id);
+		const Component&			get(ID id) const;
+
+		std::size_t					size() const;
+		Component&					at(std::size_t index);
+		const Component&			at(std::size_t index) const;
+		ID							getOwner(std::size_t index) const;
+
+
+	private:
+		static const std::size_t	NoIndex = static_cast<std::size_t>(-1);
+
+		std::vector<Component>		mComponents;
+		std::vector<ID>				mOwners;
+		std::vector<std::size_t>	mIndices;
+};
+
+#include "ComponentArray.inl"
+#endif // BOOK_COMPONENTARRAY_HPP
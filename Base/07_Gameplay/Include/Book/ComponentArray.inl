@@ -0,0 +1,75 @@
+
+template <typename Component>
+void ComponentArray<Component>::insert(ID id, const Component& component)
+{
+	assert(!contains(id));
+
+	if (id >= mIndices.size())
+		mIndices.resize(id + 1, NoIndex);
+
+	mIndices[id] = mComponents.size();
+	mComponents.push_back(component);
+	mOwners.push_back(id);
+}
+
+template <typename Component>
+void ComponentArray<Component>::remove(ID id)
+{
+	assert(contains(id));
+
+	// Move the last component into the hole, keep the array packed
+	std::size_t index = mIndices[id];
+	std::size_t last = mComponents.size() - 1;
+
+	mComponents[index] = mComponents[last];
+	mOwners[index] = mOwners[last];
+	mIndices[mOwners[index]] = index;
+
+	mComponents.pop_back();
+	mOwners.pop_back();
+	mIndices[id] = NoIndex;
+}
+
+template <typename Component>
+bool ComponentArray<Component>::contains(ID id) const
+{
+	return id < mIndices.size() && mIndices[id] != NoIndex;
+}
+
+template <typename Component>
+Component& ComponentArray<Component>::get(ID id)
+{
+	assert(contains(id));
+	return mComponents[mIndices[id]];
+}
+
+template <typename Component>
+const Component& ComponentArray<Component>::get(ID id) const
+{
+	assert(contains(id));
+	return mComponents[mIndices[id]];
+}
+
+template <typename Component>
+std::size_t ComponentArray<Component>::size() const
+{
+	return mComponents.size();
+}
+
+template <typename Component>
+Component& ComponentArray<Component>::at(std::size_t index)
+{
+	return mComponents[index];
+}
+
+template <typename Component>
+const Component& ComponentArray<Component>::at(std::size_t index) const
+{
+	return mComponents[index];
+}
+
+template <typename Component>
+typename ComponentArray<Component>::ID ComponentArray<Component>::getOwner(std::size_t index) const
+{
+	return mOwners[index];
+}
@@ -0,0 +1,69 @@
+#ifndef BOOK_COMPONENTS_HPP
+#define BOOK_COMPONENTS_HPP
+
+#include <Book/DataTables.hpp>
+#include <Book/CollisionMask.hpp>
+
+#include <SFML/System/Time.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+
+#include <vector>
+
+
+// Plain data stored in the EntityRegistry; behavior lives in the systems
+namespace Components
+{
+	struct Transform
+	{
+		sf::Vector2f					position;
+		sf::Vector2f					previousPosition;
+		float							rotation;
+	};
+
+	struct Velocity
+	{
+		sf::Vector2f					value;
+	};
+
+	struct Hitpoints
+	{
+		int								value;
+	};
+
+	struct Weapon
+	{
+		sf::Time						fireInterval;
+		sf::Time						fireCountdown;
+		int								fireRateLevel;
+		int								spreadLevel;
+		int								missileAmmo;
+		int								energy;
+		bool							isFiring;
+		bool							isLaunchingMissile;
+		bool							isLaunchingEnergy;
+	};
+
+	struct MovementPattern
+	{
+		const std::vector<Direction>*	directions;
+		float							speed;
+		float							travelledDistance;
+		std::size_t						directionIndex;
+	};
+
+	struct Sprite
+	{
+		sf::Sprite						sprite;
+	};
+
+	struct Collider
+	{
+		unsigned int					category;
+		unsigned int					mask;
+		const CollisionMask*			shape;		// Null if the bounding box is exact enough
+	};
+}
+
+#endif // BOOK_COMPONENTS_HPP
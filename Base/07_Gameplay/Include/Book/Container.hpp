@@ -3,6 +3,8 @@
 
 #include <Book/Component.hpp>
 
+#include <SFML/Graphics/RenderTexture.hpp>
+
 #include <vector>
 #include <memory>
 
@@ -18,6 +20,7 @@ class Container : public Component
 
 	public:
 							Container();
+							~Container();
 
         void				pack(Component::Ptr component);
 
@@ -25,8 +28,11 @@ class Container : public Component
         virtual void		handleEvent(const sf::Event& event);
 		bool				checkWorldBounds();
 
+	protected:
+		virtual void		requestRedraw();
+
     private:
-        virtual void		draw(sf::RenderTarget& target, sf::RenderStates states) const;
+        virtual void		drawCounted(CountingTarget& target, sf::RenderStates states) const;
 
         bool				hasSelection() const;
         void				select(std::size_t index);
@@ -39,6 +45,11 @@ class Container : public Component
         int								mSelectedChild;
 		bool							mIsStickMove;
 		float							mStickSensitivity;
+
+		// Children drawn offscreen, redrawn only after one of them changed.
+		// Children are drawn at their position when packed or changed.
+		mutable sf::RenderTexture		mCache;
+		mutable bool					mCacheValid;
 };
 
 }
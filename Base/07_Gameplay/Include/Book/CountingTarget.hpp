@@ -0,0 +1,53 @@
+#ifndef BOOK_COUNTINGTARGET_HPP
+#define BOOK_COUNTINGTARGET_HPP
+
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/View.hpp>
+#include <SFML/System/Vector2.hpp>
+
+
+namespace sf
+{
+	class RenderTarget;
+	class Sprite;
+	class Text;
+	class Shape;
+}
+
+namespace GUI
+{
+	class Component;
+}
+
+class RenderStatistics;
+
+// Stands in for a render target at the places that draw a frame, and reports every
+// draw to the statistics before passing it on. There is one overload per kind of
+// drawable the game draws, so that the statistics never have to find out the type.
+class CountingTarget
+{
+	public:
+		// Without statistics, draws are passed on uncounted
+									CountingTarget(sf::RenderTarget& target, RenderStatistics* statistics);
+
+		void						draw(const sf::Sprite& sprite, const sf::RenderStates& states = sf::RenderStates::Default);
+		void						draw(const sf::Text& text, const sf::RenderStates& states = sf::RenderStates::Default);
+		void						draw(const sf::Shape& shape, const sf::RenderStates& states = sf::RenderStates::Default);
+		// Components count the drawables they are made of
+		void						draw(const GUI::Component& component, const sf::RenderStates& states = sf::RenderStates::Default);
+
+		void						setView(const sf::View& view);
+		const sf::View&				getView() const;
+		const sf::View&				getDefaultView() const;
+		sf::Vector2u				getSize() const;
+
+		RenderStatistics*			getStatistics() const;
+		sf::RenderTarget&			getTarget() const;
+
+
+	private:
+		sf::RenderTarget*			mTarget;
+		RenderStatistics*			mStatistics;
+};
+
+#endif // BOOK_COUNTINGTARGET_HPP
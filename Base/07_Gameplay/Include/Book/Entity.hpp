@@ -2,12 +2,17 @@
 #define BOOK_ENTITY_HPP
 
 #include <Book/SceneNode.hpp>
+#include <Book/EntityRegistry.hpp>
 
+#include <SFML/Graphics/Sprite.hpp>
 
+
+// Scene node facade over the entity's components in the EntityRegistry
 class Entity : public SceneNode
 {
 	public:
-		explicit			Entity(int hitpoints);
+							Entity(EntityRegistry& registry, int hitpoints);
+		virtual				~Entity();
 
 		void				setVelocity(sf::Vector2f velocity);
 		void				setVelocity(float vx, float vy);
@@ -15,20 +20,40 @@ class Entity : public SceneNode
 		void				accelerate(float vx, float vy);
 		sf::Vector2f		getVelocity() const;
 
+		// Hide sf::Transformable's position and rotation; the registry's transform is the only
+		// one used, the sf::Transformable part of an entity stays untouched
+		void				setPosition(sf::Vector2f position);
+		void				setPosition(float x, float y);
+		void				move(sf::Vector2f offset);
+		void				move(float offsetX, float offsetY);
+		void				setRotation(float angle);
+		sf::Vector2f		getPosition() const;
+		float				getRotation() const;
+
 		int					getHitpoints() const;
 		void				repair(int points);
 		void				damage(int points);
 		void				destroy();
 		virtual bool		isDestroyed() const;
 
+		virtual sf::FloatRect	getBoundingRect() const;
+		EntityRegistry::ID	getID() const;
+
 
 	protected:
-		virtual void		updateCurrent(sf::Time dt, CommandQueue& commands);
+		void				setSprite(const sf::Sprite& sprite);
+		sf::Sprite&			getSprite();
+		const sf::Sprite&	getSprite() const;
+		EntityRegistry&		getRegistry() const;
+
+
+		virtual sf::Transform	getLocalTransform() const;
+		virtual sf::Transform	getRenderTransform() const;
 
 
 	private:
-		sf::Vector2f		mVelocity;
-		int					mHitpoints;
+		EntityRegistry&		mRegistry;
+		EntityRegistry::ID	mID;
 };
 
 #endif // BOOK_ENTITY_HPP
@@ -0,0 +1,90 @@
+#ifndef BOOK_ENTITYREGISTRY_HPP
+#define BOOK_ENTITYREGISTRY_HPP
+
+#include <Book/Components.hpp>
+#include <Book/ComponentArray.hpp>
+#include <Book/BoundingBoxArray.hpp>
+
+#include <SFML/System/NonCopyable.hpp>
+
+#include <vector>
+#include <map>
+
+
+class Entity;
+
+namespace sf
+{
+	class Texture;
+}
+
+// Owns the component data of all entities in a level.
+// Transform, velocity, hitpoints, sprite and collider are present for every entity
+// and are kept in parallel arrays sharing one dense index; optional components
+// live in their own ComponentArray. The bounding boxes are scratch data, rebuilt
+// for the current dense order once per tick by Systems::updateColliders().
+class EntityRegistry : private sf::NonCopyable
+{
+	public:
+		typedef std::size_t										ID;
+
+
+	public:
+																EntityRegistry();
+
+		ID														create(Entity& facade);
+		void													destroy(ID id);
+
+		std::size_t												size() const;
+		std::size_t												indexOf(ID id) const;
+		Entity&													getFacade(std::size_t index) const;
+
+		std::vector<Components::Transform>&						getTransforms();
+		const std::vector<Components::Transform>&				getTransforms() const;
+		std::vector<Components::Velocity>&						getVelocities();
+		const std::vector<Components::Velocity>&				getVelocities() const;
+		std::vector<Components::Hitpoints>&						getHitpoints();
+		const std::vector<Components::Hitpoints>&				getHitpoints() const;
+		std::vector<Components::Sprite>&						getSprites();
+		const std::vector<Components::Sprite>&					getSprites() const;
+		std::vector<Components::Collider>&						getColliders();
+		const std::vector<Components::Collider>&				getColliders() const;
+
+		ComponentArray<Components::Weapon>&						getWeapons();
+		ComponentArray<Components::MovementPattern>&			getMovementPatterns();
+
+		// Fraction of the tick between previous and current transforms at which entities are drawn
+		void													setInterpolation(float interpolation);
+		float													getInterpolation() const;
+
+		BoundingBoxArray&										getBoundingBoxes();
+		const BoundingBoxArray&									getBoundingBoxes() const;
+
+		// Pixel masks are looked up by the texture of an entity's sprite, which must show the whole texture
+		void													addCollisionMask(const sf::Texture& texture);
+		const CollisionMask*									getCollisionMask(const sf::Texture* texture) const;
+
+
+	private:
+		static const std::size_t								NoIndex = static_cast<std::size_t>(-1);
+
+		std::vector<Components::Transform>						mTransforms;
+		std::vector<Components::Velocity>						mVelocities;
+		std::vector<Components::Hitpoints>						mHitpoints;
+		std::vector<Components::Sprite>							mSprites;
+		std::vector<Components::Collider>						mColliders;
+		std::vector<Entity*>									mFacades;
+		std::vector<ID>											mOwners;
+
+		std::vector<std::size_t>								mIndices;
+		std::vector<ID>											mFreeIDs;
+
+		ComponentArray<Components::Weapon>						mWeapons;
+		ComponentArray<Components::MovementPattern>				mMovementPatterns;
+
+		float													mInterpolation;
+		BoundingBoxArray										mBoundingBoxes;
+		std::map<const sf::Texture*, CollisionMask>				mCollisionMasks;
+};
+
+#endif // BOOK_ENTITYREGISTRY_HPP
@@ -14,7 +14,7 @@ class GameOverState : public State
 	public:
 		GameOverState(StateStack& stack, Context context);
 
-		virtual void				draw();
+		virtual void				draw(float interpolation);
 		virtual bool				update(sf::Time dt);
 		virtual bool				handleEvent(const sf::Event& event);
 
@@ -6,9 +6,11 @@
 #include <Book/Level2.hpp>
 #include <Book/Level3.hpp>
 #include <Book/Player.hpp>
+#include <Book/CountingTarget.hpp>
 
 #include <SFML/Graphics/Sprite.hpp>
 #include <SFML/Graphics/Text.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
 
 
 class GameState : public State
@@ -16,7 +18,7 @@ class GameState : public State
 	public:
 							GameState(StateStack& stack, Context context);
 
-		virtual void		draw();
+		virtual void		draw(float interpolation);
 		virtual bool		update(sf::Time dt);
 		virtual bool		handleEvent(const sf::Event& event);
 
@@ -25,6 +27,12 @@ class GameState : public State
 			LVL_1, LVL_2, LVL_3, TOTAL_LEVELS
 		};
 
+	private:
+		void				drawScene(CountingTarget& target, float interpolation);
+		void				drawLevel(CountingTarget& target, float interpolation);
+		void				pushOverlay(States::ID stateID);
+
+
 	private:
 		Level1				level1;
 		Level2				level2;
@@ -32,6 +40,14 @@ class GameState : public State
 		Player&				mPlayer;
 
 		CurrentLevel		level;
+
+		// Scene rendered below window resolution when frames take too long; HUD and GUI stay native
+		sf::RenderTexture	mSceneTexture;
+
+		// Last frame of the scene, drawn instead of the scene while an overlay stops the simulation
+		sf::RenderTexture	mFreezeFrame;
+		bool				mFrozen;
+		bool				mFreezeFrameCaptured;
 };
 
 #endif // BOOK_GAMESTATE_HPP
\ No newline at end of file
@@ -0,0 +1,63 @@
+#ifndef BOOK_GLYPHTRACKER_HPP
+#define BOOK_GLYPHTRACKER_HPP
+
+#include <SFML/Config.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <set>
+#include <vector>
+
+
+namespace sf
+{
+	class Font;
+	class Text;
+}
+
+// sf::Font rasterizes each glyph the first time a character is drawn at a size, which
+// stalls the frame it happens in. prewarm() rasterizes the printable ASCII range for every
+// size the game uses at startup; the tracker then mirrors the font's glyph cache to report
+// every glyph rasterized later, and checks the glyph pages of those sizes for growth.
+class GlyphTracker
+{
+	public:
+									GlyphTracker();
+
+		void						prewarm(const sf::Font& font);
+
+		// Glyphs the font rasterizes to draw the text; each counts once, the first time it is drawn
+		std::size_t					track(const sf::Text& text);
+
+		// Pre-warmed glyph pages whose texture grew since prewarm(), i.e. that received new glyphs
+		std::size_t					countGrownPages() const;
+
+
+	private:
+		struct Glyph
+		{
+			const sf::Font*			font;
+			unsigned int			characterSize;
+			sf::Uint32				character;
+			bool					bold;
+
+			bool					operator< (const Glyph& other) const;
+		};
+
+		struct Page
+		{
+			const sf::Font*			font;
+			unsigned int			characterSize;
+			sf::Vector2u			textureSize;
+		};
+
+
+	private:
+		bool						insert(const sf::Font& font, unsigned int characterSize, sf::Uint32 character, bool bold);
+
+
+	private:
+		std::set<Glyph>				mRasterized;
+		std::vector<Page>			mPages;
+};
+
+#endif // BOOK_GLYPHTRACKER_HPP
@@ -27,7 +27,7 @@ class Label : public Component
 		bool				checkWorldBounds();
 
     private:
-        void				draw(sf::RenderTarget& target, sf::RenderStates states) const;
+        void				drawCounted(CountingTarget& target, sf::RenderStates states) const;
 
 
     private:
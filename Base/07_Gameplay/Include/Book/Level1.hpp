@@ -4,12 +4,17 @@
 #include <Book/ResourceHolder.hpp>
 #include <Book/ResourceIdentifiers.hpp>
 #include <Book/SceneNode.hpp>
+#include <Book/EntityRegistry.hpp>
 #include <Book/SpriteNode.hpp>
 #include <Book/Aircraft.hpp>
 #include <Book/CommandQueue.hpp>
+#include <Book/RenderQueue.hpp>
+#include <Book/CountingTarget.hpp>
+#include <Book/QualityGovernor.hpp>
 #include <Book/Command.hpp>
 #include <Book/Player.hpp>
 #include <Book/SoundPlayer.hpp>
+#include <Book/Profiler.hpp>
 
 #include <SFML/System/NonCopyable.hpp>
 #include <SFML/Graphics/View.hpp>
@@ -23,15 +28,18 @@
 namespace sf
 {
 	class RenderWindow;
+	class RenderTarget;
 }
 
 class Level1 : private sf::NonCopyable
 {
 	public:
 		explicit							Level1(sf::RenderWindow& window, FontHolder& fonts,
-													Player& player, SoundPlayer& sounds);
+													Player& player, SoundPlayer& sounds, Profiler& profiler,
+													ResourceBudget& textureBudget, const AssetPack& assets);
 		void								update(sf::Time dt);
-		void								draw();
+		// interpolation: fraction of a tick elapsed since the last update, 0 to 1
+		void								draw(CountingTarget& target, const QualityGovernor& quality, float interpolation);
 		
 		CommandQueue&						getCommandQueue();
 
@@ -45,7 +53,7 @@ class Level1 : private sf::NonCopyable
 		void								adaptPlayerPosition();
 		void								adaptPlayerVelocity(float deltaTime);
 		void								handleCollisions();
-		void								updateSounds();
+		void								updateSounds(sf::Time dt);
 		
 		void								buildScene();
 		void								addEnemies();
@@ -56,8 +64,6 @@ class Level1 : private sf::NonCopyable
 		sf::FloatRect						getViewBounds() const;
 		sf::FloatRect						getBattlefieldBounds() const;
 
-		bool								matchesCategories(SceneNode::Pair& colliders, Category::Type type1, Category::Type type2);
-
 	private:
 		enum Layer
 		{
@@ -87,14 +93,19 @@ class Level1 : private sf::NonCopyable
 		TextureHolder						mTextures;
 		FontHolder&							mFonts;
 		SoundPlayer&						mSounds;
+		Profiler&							mProfiler;
 		
+		EntityRegistry						mRegistry;
 		SceneNode							mSceneGraph;
 		std::array<SceneNode*, LayerCount>	mSceneLayers;
 		CommandQueue						mCommandQueue;
+		RenderQueue							mRenderQueue;
 
 		sf::FloatRect						mWorldBounds;
 		sf::Vector2f						mSpawnPosition;
 		float								mScrollSpeed;
+		sf::Vector2f						mPreviousViewCenter;
+		bool								mTexturesLoaded;
 		Aircraft*							mPlayerAircraft;
 		Player&								mPlayer;
 
@@ -0,0 +1,45 @@
+#ifndef BOOK_LOADTIMELINE_HPP
+#define BOOK_LOADTIMELINE_HPP
+
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Mutex.hpp>
+#include <SFML/System/NonCopyable.hpp>
+
+#include <string>
+#include <vector>
+
+
+// Records when each asset was decoded and uploaded, relative to the creation of the
+// timeline, and writes the result as CSV to track cold-start time. Safe to record from
+// worker threads.
+class LoadTimeline : private sf::NonCopyable
+{
+	public:
+									LoadTimeline();
+
+		// Time since the timeline was created; pass as start to record()
+		sf::Time					now() const;
+		void						record(const std::string& asset, const std::string& phase, unsigned int thread, sf::Time start);
+
+		// One line per recorded step, then the total time
+		bool						writeToFile(const std::string& filename) const;
+
+
+	private:
+		struct Step
+		{
+			std::string				asset;
+			std::string				phase;
+			unsigned int			thread;
+			sf::Time				start;
+			sf::Time				end;
+		};
+
+
+	private:
+		sf::Clock					mClock;
+		std::vector<Step>			mSteps;
+		mutable sf::Mutex			mMutex;
+};
+
+#endif // BOOK_LOADTIMELINE_HPP
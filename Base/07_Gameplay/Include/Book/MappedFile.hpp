@@ -0,0 +1,33 @@
+#ifndef BOOK_MAPPEDFILE_HPP
+#define BOOK_MAPPEDFILE_HPP
+
+#include <SFML/Config.hpp>
+#include <SFML/System/NonCopyable.hpp>
+
+#include <string>
+#include <vector>
+
+
+// Read-only view of a whole file. Memory-mapped where the platform supports it, so the
+// pages are only read from disk as they are accessed; read into memory elsewhere.
+class MappedFile : private sf::NonCopyable
+{
+	public:
+								MappedFile();
+								~MappedFile();
+
+		bool					open(const std::string& filename);
+		void					close();
+
+		const sf::Uint8*		getData() const;
+		std::size_t				getSize() const;
+
+
+	private:
+		const sf::Uint8*		mData;
+		std::size_t				mSize;
+		bool					mMapped;
+		std::vector<sf::Uint8>	mBuffer;
+};
+
+#endif // BOOK_MAPPEDFILE_HPP
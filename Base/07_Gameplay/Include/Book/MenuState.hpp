@@ -13,7 +13,7 @@ class MenuState : public State
 	public:
 								MenuState(StateStack& stack, Context context);
 
-		virtual void			draw();
+		virtual void			draw(float interpolation);
 		virtual bool			update(sf::Time dt);
 		virtual bool			handleEvent(const sf::Event& event);
 
@@ -3,6 +3,7 @@
 
 #include <Book/ResourceHolder.hpp>
 #include <Book/ResourceIdentifiers.hpp>
+#include <Book/AssetPack.hpp>
 
 #include <SFML/System/NonCopyable.hpp>
 #include <SFML/Audio/Music.hpp>
@@ -14,7 +15,7 @@
 class MusicPlayer : private sf::NonCopyable
 {
 	public:
-									MusicPlayer();
+		explicit					MusicPlayer(const AssetPack& pack);
 
 		void						play(Music::ID theme);
 		void						stop();
@@ -25,6 +26,7 @@ class MusicPlayer : private sf::NonCopyable
 
 	private:
 		sf::Music							mMusic;
+		const AssetPack&					mPack;
 		std::map<Music::ID, std::string>	mFilenames;
 		float								mVolume;
 };
@@ -14,7 +14,7 @@ class PauseState : public State
 							PauseState(StateStack& stack, Context context);
 							~PauseState();
 							
-		virtual void		draw();
+		virtual void		draw(float interpolation);
 		virtual bool		update(sf::Time dt);
 		virtual bool		handleEvent(const sf::Event& event);
 
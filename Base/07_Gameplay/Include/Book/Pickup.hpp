@@ -5,8 +5,6 @@
 #include <Book/Command.hpp>
 #include <Book/ResourceIdentifiers.hpp>
 
-#include <SFML/Graphics/Sprite.hpp>
-
 
 class Aircraft;
 
@@ -25,21 +23,15 @@ class Pickup : public Entity
 
 
 	public:
-								Pickup(Type type, const TextureHolder& textures);
+								Pickup(Type type, const TextureHolder& textures, EntityRegistry& registry);
 
 		virtual unsigned int	getCategory() const;
-		virtual sf::FloatRect	getBoundingRect() const;
 
 		void 					apply(Aircraft& player) const;
 
 
-	protected:
-		virtual void			drawCurrent(sf::RenderTarget& target, sf::RenderStates states) const;
-
-
 	private:
 		Type 					mType;
-		sf::Sprite				mSprite;
 };
 
 #endif // BOOK_PICKUP_HPP
\ No newline at end of file
@@ -0,0 +1,57 @@
+#ifndef BOOK_PROFILER_HPP
+#define BOOK_PROFILER_HPP
+
+#include <SFML/System/Time.hpp>
+#include <SFML/System/NonCopyable.hpp>
+
+#include <chrono>
+#include <map>
+#include <string>
+
+
+// Accumulates the cost of named sections of a frame (e.g. the collision narrow
+// phase) and summarizes them for the statistics overlay
+class Profiler : private sf::NonCopyable
+{
+	public:
+		// Nanosecond clock for sections too short for sf::Clock's microseconds
+		class Stopwatch
+		{
+			public:
+									Stopwatch();
+				sf::Int64			getElapsedNanoseconds() const;
+
+			private:
+				std::chrono::steady_clock::time_point	mStart;
+		};
+
+
+	public:
+									Profiler();
+
+		// Adds time spent on count items of the given section
+		void						record(const std::string& section, sf::Time time, std::size_t count);
+		void						recordNanoseconds(const std::string& section, sf::Int64 nanoseconds, std::size_t count);
+
+		// Adds to a plain counter, such as the number of culled nodes
+		void						count(const std::string& counter, std::size_t count);
+
+		// One line per section recorded since the last call: items and average cost
+		// per item for timed sections, items only for counters
+		std::string					flush();
+
+
+	private:
+		struct Section
+		{
+			sf::Int64				nanoseconds;
+			std::size_t				count;
+			bool					timed;
+		};
+
+
+	private:
+		std::map<std::string, Section>	mSections;
+};
+
+#endif // BOOK_PROFILER_HPP
@@ -4,8 +4,6 @@
 #include <Book/Entity.hpp>
 #include <Book/ResourceIdentifiers.hpp>
 
-#include <SFML/Graphics/Sprite.hpp>
-
 
 class Projectile : public Entity
 {
@@ -22,7 +20,7 @@ class Projectile : public Entity
 
 
 	public:
-								Projectile(Type type, const TextureHolder& textures);
+								Projectile(Type type, const TextureHolder& textures, EntityRegistry& registry);
 
 		void					guideTowards(sf::Vector2f position);
 		bool					isGuided() const;
@@ -31,19 +29,16 @@ class Projectile : public Entity
 		void					split();
 
 		virtual unsigned int	getCategory() const;
-		virtual sf::FloatRect	getBoundingRect() const;
 		float					getMaxSpeed() const;
 		int						getDamage() const;
 
 	
 	private:
 		virtual void			updateCurrent(sf::Time dt, CommandQueue& commands);
-		virtual void			drawCurrent(sf::RenderTarget& target, sf::RenderStates states) const;
 
 
 	private:
 		Type					mType;
-		sf::Sprite				mSprite;
 		sf::Vector2f			mTargetDirection;
 };
 
@@ -0,0 +1,52 @@
+#ifndef BOOK_QUALITYGOVERNOR_HPP
+#define BOOK_QUALITYGOVERNOR_HPP
+
+#include <SFML/System/Time.hpp>
+
+#include <cstddef>
+
+
+// Keeps frame time under budget by trading quality for speed. Frame times are averaged
+// over a window of frames; a slow window lowers the quality level at once, while raising
+// it takes several windows with clear headroom, so the level doesn't oscillate.
+class QualityGovernor
+{
+	public:
+		enum Level
+		{
+			Low,
+			Medium,
+			High,
+			LevelCount
+		};
+
+
+	public:
+								QualityGovernor();
+
+		void					setBudget(sf::Time budget);
+
+		// Returns true if the quality level changed
+		bool					addFrameTime(sf::Time time);
+
+		Level					getLevel() const;
+
+		// Concurrent sound effects
+		std::size_t				getMaxVoices() const;
+		// Whether texts only there for detail (enemy hitpoints) are drawn
+		bool					drawsDetails() const;
+		// Distance around the view within which nodes and sprites are still drawn
+		float					getCullMargin() const;
+		// Upper bound for the dynamic scene resolution
+		float					getMaxResolutionScale() const;
+
+
+	private:
+		sf::Time				mBudget;
+		sf::Time				mAccumulatedTime;
+		std::size_t				mSamples;
+		std::size_t				mCalmWindows;
+		Level					mLevel;
+};
+
+#endif // BOOK_QUALITYGOVERNOR_HPP
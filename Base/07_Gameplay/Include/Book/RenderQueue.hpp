@@ -0,0 +1,80 @@
+#ifndef BOOK_RENDERQUEUE_HPP
+#define BOOK_RENDERQUEUE_HPP
+
+#include <SFML/Config.hpp>
+#include <SFML/System/NonCopyable.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+
+#include <vector>
+
+
+namespace sf
+{
+	class Drawable;
+	class Sprite;
+	class Text;
+	class Texture;
+}
+
+class CountingTarget;
+
+// Collects the drawables of a frame and draws them sorted by a 64-bit key:
+// layer (8 bits), depth (24 bits), texture (32 bits). Depth decides what overlaps
+// what within a layer; among drawables of equal depth, those sharing a texture end
+// up next to each other, so the texture is bound once for all of them. Equal keys
+// keep their submission order.
+class RenderQueue : private sf::NonCopyable
+{
+	public:
+		enum Layer
+		{
+			Background,
+			Entities,
+			Overlay,
+			Details,
+			LayerCount
+		};
+
+
+	public:
+									RenderQueue();
+
+		// Submissions to a disabled layer are dropped
+		void						setLayerEnabled(Layer layer, bool enabled);
+
+		// The drawable must stay alive until flush(); higher depths are drawn on top
+		void						submit(const sf::Sprite& sprite, const sf::RenderStates& states,
+										Layer layer, const sf::Texture* texture, sf::Uint32 depth = 0);
+		void						submit(const sf::Text& text, const sf::RenderStates& states,
+										Layer layer, const sf::Texture* texture, sf::Uint32 depth = 0);
+
+		// Draws and removes everything submitted; returns the texture changes saved by sorting
+		std::size_t					flush(CountingTarget& target);
+
+
+	private:
+		struct Item
+		{
+			sf::Uint64				key;
+			const sf::Drawable*		drawable;
+			bool					isText;
+			sf::RenderStates		states;
+		};
+
+
+	private:
+		void						push(const sf::Drawable& drawable, bool isText, const sf::RenderStates& states,
+										Layer layer, const sf::Texture* texture, sf::Uint32 depth);
+		sf::Uint32					getTextureID(const sf::Texture* texture);
+		void						sort();
+		static std::size_t			countTextureChanges(const std::vector<Item>& items);
+
+
+	private:
+		std::vector<Item>			mItems;
+		std::vector<Item>			mScratch;
+		std::vector<const sf::Texture*>	mTextures;
+		bool						mLayerEnabled[LayerCount];
+};
+
+#endif // BOOK_RENDERQUEUE_HPP
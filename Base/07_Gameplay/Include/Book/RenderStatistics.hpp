@@ -0,0 +1,90 @@
+#ifndef BOOK_RENDERSTATISTICS_HPP
+#define BOOK_RENDERSTATISTICS_HPP
+
+#include <Book/GlyphTracker.hpp>
+#include <Book/RenderQueue.hpp>
+#include <Book/StateIdentifiers.hpp>
+
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/System/NonCopyable.hpp>
+
+#include <string>
+
+
+namespace sf
+{
+	class Sprite;
+	class Text;
+	class Shape;
+}
+
+// Counts what a frame costs: draw calls, vertices, texture switches and text draws,
+// in total and per scope (state, and render queue layer inside the state). Works on
+// the drawables alone, so the numbers can be checked without a window or GPU.
+class RenderStatistics : private sf::NonCopyable
+{
+	public:
+		struct Counts
+		{
+									Counts();
+
+			std::size_t				drawCalls;
+			std::size_t				vertices;
+			std::size_t				textureSwitches;
+			std::size_t				textDraws;
+		};
+
+		// Layer of the draws made outside a render queue
+		static const std::size_t	NoLayer = RenderQueue::LayerCount;
+
+
+	public:
+									RenderStatistics();
+
+		// Forgets the counts of the previous frame
+		void						beginFrame();
+
+		// Off, draws are neither counted nor checked for glyph rasterization; the overlay
+		// turns it on while shown. Glyphs first drawn while off are reported once it is on again.
+		void						setEnabled(bool enabled);
+		bool						isEnabled() const;
+
+		// Following draws are attributed to the given state, States::None for the overlay; resets the layer
+		void						setState(States::ID state);
+		// Following draws are attributed to the given RenderQueue::Layer of the current state, or NoLayer
+		void						setLayer(std::size_t layer);
+
+		// The caller knows what it draws, so the kind of drawable is never looked up
+		void						recordSprite(const sf::Sprite& sprite);
+		void						recordText(const sf::Text& text);
+		void						recordShape(const sf::Shape& shape);
+
+		const Counts&				getFrameTotal() const;
+		// Glyphs rasterized while drawing since the font was pre-warmed; should stay 0
+		std::size_t					getRasterizedGlyphs() const;
+		GlyphTracker&				getGlyphs();
+		// Counts of a scope; zero if nothing was drawn in it
+		const Counts&				getFrameCounts(States::ID state, std::size_t layer) const;
+
+		// Frame total, then one line per scope drawn in
+		std::string					summary() const;
+
+
+	private:
+		// Textures are told apart by object and page, so that text needs no font texture lookup
+		void						record(std::size_t vertices, const void* texture, unsigned int page, bool isText);
+
+
+	private:
+		Counts						mTotal;
+		Counts						mScopes[States::Count][NoLayer + 1];
+		Counts*						mScope;
+		States::ID					mState;
+		const void*					mLastTexture;
+		unsigned int				mLastPage;
+		GlyphTracker				mGlyphs;
+		std::size_t					mRasterizedGlyphs;
+		bool						mEnabled;
+};
+
+#endif // BOOK_RENDERSTATISTICS_HPP
@@ -0,0 +1,35 @@
+#ifndef BOOK_RESOLUTIONSCALER_HPP
+#define BOOK_RESOLUTIONSCALER_HPP
+
+#include <SFML/System/Time.hpp>
+
+#include <cstddef>
+
+
+// Picks the resolution the scene is rendered at, as a fraction of the window size.
+// Frame times, up to and including display() so the GPU's fill work is covered, are
+// averaged over a few frames; the scale steps down while the average exceeds the budget
+// and back up once there is clear headroom again.
+class ResolutionScaler
+{
+	public:
+								ResolutionScaler();
+
+		void					setBudget(sf::Time budget);
+		// Caps the scale; lowering it below the current scale takes effect at once
+		void					setMaxScale(float maxScale);
+		void					addFrameTime(sf::Time time);
+
+		// Between 0.5 (half the window's width and height) and the maximum, at most 1 (native)
+		float					getScale() const;
+
+
+	private:
+		sf::Time				mBudget;
+		sf::Time				mAccumulatedTime;
+		std::size_t				mSamples;
+		float					mScale;
+		float					mMaxScale;
+};
+
+#endif // BOOK_RESOLUTIONSCALER_HPP
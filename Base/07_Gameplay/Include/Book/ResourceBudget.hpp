@@ -0,0 +1,103 @@
+#ifndef BOOK_RESOURCEBUDGET_HPP
+#define BOOK_RESOURCEBUDGET_HPP
+
+#include <SFML/Config.hpp>
+#include <SFML/System/Time.hpp>
+#include <SFML/System/NonCopyable.hpp>
+
+#include <vector>
+#include <functional>
+#include <cstddef>
+
+
+namespace sf
+{
+	class Texture;
+}
+
+// Memory used by a loaded resource; only textures are accounted for
+template <typename Resource>
+std::size_t getResourceBytes(const Resource&)
+{
+	return 0;
+}
+
+std::size_t getResourceBytes(const sf::Texture& texture);
+
+// State given to a resource after it was loaded, saved when it is evicted and applied again
+// when it is reloaded; only textures have any (smoothing, repeating)
+template <typename Resource>
+struct ResourceSettings
+{
+	void						save(const Resource&) {}
+	void						apply(Resource&) const {}
+};
+
+template <>
+struct ResourceSettings<sf::Texture>
+{
+								ResourceSettings();
+
+	void						save(const sf::Texture& texture);
+	void						apply(sf::Texture& texture) const;
+
+	bool						smooth;
+	bool						repeated;
+};
+
+
+// Keeps the resources of any number of holders within a memory budget. When the resident
+// total exceeds it, the least recently used resources that aren't pinned are evicted; their
+// holders reload them when they are pinned again.
+class ResourceBudget : private sf::NonCopyable
+{
+	public:
+		typedef std::size_t			Handle;
+
+
+	public:
+		explicit					ResourceBudget(std::size_t maxBytes);
+
+		// The evict function frees the resource's memory, keeping the object itself valid
+		Handle						add(std::size_t bytes, std::function<void()> evict);
+		void						remove(Handle handle);
+
+		void						touch(Handle handle);
+		void						setPinned(Handle handle, bool pinned);
+		void						markReloaded(Handle handle, std::size_t bytes, sf::Time stall);
+
+		// Evicts until the resident total fits the budget, or nothing evictable is left. Does
+		// nothing unless bytes were added or a resource was unpinned since the last call.
+		void						enforce();
+
+		std::size_t					getResidentBytes() const;
+		std::size_t					getEvictionCount() const;
+		std::size_t					getReloadCount() const;
+		sf::Time					getReloadTime() const;
+
+
+	private:
+		struct Entry
+		{
+			std::size_t				bytes;
+			sf::Uint64				lastUse;
+			bool					pinned;
+			bool					resident;
+			std::function<void()>	evict;
+		};
+
+
+	private:
+		std::vector<Entry>			mEntries;
+		std::vector<Handle>			mFreeHandles;
+		std::size_t					mMaxBytes;
+		std::size_t					mResidentBytes;
+		sf::Uint64					mUseCounter;
+		bool						mEnforceNeeded;
+
+		std::size_t					mEvictionCount;
+		std::size_t					mReloadCount;
+		sf::Time					mReloadTime;
+};
+
+#endif // BOOK_RESOURCEBUDGET_HPP
@@ -0,0 +1,78 @@
+#ifndef BOOK_RESOURCEDECODER_HPP
+#define BOOK_RESOURCEDECODER_HPP
+
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <memory>
+#include <string>
+
+
+// Splits loading a resource from file into decode(), which may run on a worker thread,
+// and finish(), which runs on the thread owning the holder. By default the whole load
+// happens in decode().
+template <typename Resource>
+struct ResourceDecoder
+{
+	struct Decoded
+	{
+		std::unique_ptr<Resource>	resource;
+	};
+
+	static bool decode(Decoded& decoded, const std::string& filename)
+	{
+		decoded.resource.reset(new Resource());
+		return decoded.resource->loadFromFile(filename);
+	}
+
+	// The memory must outlive the resource: fonts, for one, keep reading from it
+	static bool decodeMemory(Decoded& decoded, const void* data, std::size_t size)
+	{
+		decoded.resource.reset(new Resource());
+		return decoded.resource->loadFromMemory(data, size);
+	}
+
+	static std::unique_ptr<Resource> finish(Decoded& decoded)
+	{
+		return std::move(decoded.resource);
+	}
+
+	// Both steps at once, into an existing resource
+	static bool load(Resource& resource, const std::string& filename)
+	{
+		return resource.loadFromFile(filename);
+	}
+
+	static bool loadMemory(Resource& resource, const void* data, std::size_t size)
+	{
+		return resource.loadFromMemory(data, size);
+	}
+};
+
+// Textures: the image is decoded on a worker, the upload needs the GL context of the main thread.
+// The asset pack holds the pixels already decoded, so nothing is decoded at all when it is used;
+// loose files are only a fallback for when the pack is missing.
+template <>
+struct ResourceDecoder<sf::Texture>
+{
+	struct Decoded
+	{
+									Decoded();
+
+		sf::Image					image;
+		// Raw RGBA rows to upload instead of the image, in the pack
+		const sf::Uint8*			pixels;
+		sf::Vector2u				size;
+	};
+
+	static bool								decode(Decoded& decoded, const std::string& filename);
+	static bool								decodeMemory(Decoded& decoded, const void* data, std::size_t size);
+	static std::unique_ptr<sf::Texture>		finish(Decoded& decoded);
+	static bool								load(sf::Texture& texture, const std::string& filename);
+	static bool								loadMemory(sf::Texture& texture, const void* data, std::size_t size);
+
+	private:
+		static bool							upload(Decoded& decoded, sf::Texture& texture);
+};
+
+#endif // BOOK_RESOURCEDECODER_HPP
@@ -1,32 +1,118 @@
 #ifndef BOOK_RESOURCEHOLDER_HPP
 #define BOOK_RESOURCEHOLDER_HPP
 
+#include <Book/ResourceIdentifiers.hpp>
+#include <Book/ResourceBudget.hpp>
+#include <Book/ResourceDecoder.hpp>
+#include <Book/LoadTimeline.hpp>
+#include <Book/AssetPack.hpp>
+
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Thread.hpp>
+#include <SFML/System/Mutex.hpp>
+#include <SFML/System/Lock.hpp>
+
 #include <map>
+#include <algorithm>
+#include <array>
+#include <vector>
 #include <string>
 #include <memory>
 #include <stdexcept>
 #include <cassert>
 
 
+// Dense identifiers: one slot per enum value, so a lookup is a plain array index
+template <typename Value, typename Identifier, std::size_t Count>
+class ResourceStorage
+{
+	public:
+		bool						insert(Identifier id, std::unique_ptr<Value> value);
+		Value*						find(Identifier id) const;
+
+
+	private:
+		std::array<std::unique_ptr<Value>, Count>	mValues;
+};
+
+// Other identifiers: sparse, looked up in a map
+template <typename Value, typename Identifier>
+class ResourceStorage<Value, Identifier, 0>
+{
+	public:
+		bool						insert(Identifier id, std::unique_ptr<Value> value);
+		Value*						find(Identifier id) const;
+
+
+	private:
+		std::map<Identifier, std::unique_ptr<Value>>	mValueMap;
+};
+
+
 template <typename Resource, typename Identifier>
 class ResourceHolder
 {
 	public:
+		typedef std::vector<std::pair<Identifier, std::string>>	FileList;
+
+
+	public:
+									ResourceHolder();
+									~ResourceHolder();
+
+		// Resources loaded from now on count against the budget and may be evicted while unpinned
+		void						setBudget(ResourceBudget& budget);
+		// Pinned resources are never evicted, e.g. while the scene using them is alive. Pinning
+		// reloads the evicted ones, so pin before calling get(); unpinning marks them as used
+		// last, which is all the use the budget needs to know of to evict the oldest first.
+		void						setPinned(bool pinned);
+		// Resources found in the pack are loaded from it rather than from their files
+		void						setPack(const AssetPack& pack);
+
 		void						load(Identifier id, const std::string& filename);
 
 		template <typename Parameter>
 		void						load(Identifier id, const std::string& filename, const Parameter& secondParam);
 
+		// Loads several files at once: files are decoded on worker threads, the rest of each
+		// load (e.g. texture upload) runs on the calling thread. Steps go to the timeline if given.
+		void						loadAll(const FileList& files, LoadTimeline* timeline = nullptr);
+
+		// Plain lookups; a budgeted resource must be pinned, or it may be evicted
 		Resource&					get(Identifier id);
 		const Resource&				get(Identifier id) const;
 
+		bool						isLoaded(Identifier id) const;
+
+		// Throws if any value of a dense identifier has no resource; call once all loads are done
+		void						checkAllLoaded() const;
+		// Same for the values from first to last, for holders that load a part of the identifiers
+		void						checkLoaded(Identifier first, Identifier last) const;
+
+
+	private:
+		struct Slot
+		{
+			std::unique_ptr<Resource>	resource;
+			Identifier				id;
+			std::string				filename;
+			ResourceBudget::Handle	handle;
+			bool					resident;
+			ResourceSettings<Resource>	settings;
+		};
+
 
 	private:
-		void						insertResource(Identifier id, std::unique_ptr<Resource> resource);
+		void						insertResource(Identifier id, std::unique_ptr<Resource> resource, const std::string& filename);
+		void						reload(Slot& slot);
+		bool						findInPack(Identifier id, const void*& data, std::size_t& size) const;
 
 
 	private:
-		std::map<Identifier, std::unique_ptr<Resource>>	mResourceMap;
+		ResourceStorage<Slot, Identifier, ResourceCount<Identifier>::value>	mStorage;
+		ResourceBudget*				mBudget;
+		const AssetPack*			mPack;
+		std::vector<Slot*>			mBudgetedSlots;
 };
 
 #include "ResourceHolder.inl"
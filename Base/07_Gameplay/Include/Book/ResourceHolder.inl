@@ -1,4 +1,54 @@
 
+template <typename Resource, typename Identifier>
+ResourceHolder<Resource, Identifier>::ResourceHolder()
+: mStorage()
+, mBudget(nullptr)
+, mPack(nullptr)
+, mBudgetedSlots()
+{
+}
+
+template <typename Resource, typename Identifier>
+ResourceHolder<Resource, Identifier>::~ResourceHolder()
+{
+	if (!mBudget)
+		return;
+
+	for (std::size_t i = 0; i < mBudgetedSlots.size(); ++i)
+		mBudget->remove(mBudgetedSlots[i]->handle);
+}
+
+template <typename Resource, typename Identifier>
+void ResourceHolder<Resource, Identifier>::setBudget(ResourceBudget& budget)
+{
+	assert(!mBudget);
+	mBudget = &budget;
+}
+
+template <typename Resource, typename Identifier>
+void ResourceHolder<Resource, Identifier>::setPinned(bool pinned)
+{
+	if (!mBudget)
+		return;
+
+	for (std::size_t i = 0; i < mBudgetedSlots.size(); ++i)
+	{
+		Slot& slot = *mBudgetedSlots[i];
+		mBudget->setPinned(slot.handle, pinned);
+
+		if (pinned && !slot.resident)
+			reload(slot);
+		else if (!pinned)
+			mBudget->touch(slot.handle);
+	}
+}
+
+template <typename Resource, typename Identifier>
+void ResourceHolder<Resource, Identifier>::setPack(const AssetPack& pack)
+{
+	mPack = &pack;
+}
+
 template <typename Resource, typename Identifier>
 void ResourceHolder<Resource, Identifier>::load(Identifier id, const std::string& filename)
 {
@@ -8,7 +58,7 @@ void ResourceHolder<Resource, Identifier>::load(Identifier id, const std::string
 		throw std::runtime_error("ResourceHolder::load - Failed to load " + filename);
 
 	// If loading successful, insert resource to map
-	insertResource(id, std::move(resource));
+	insertResource(id, std::move(resource), filename);
 }
 
 template <typename Resource, typename Identifier>
@@ -20,32 +70,209 @@ void ResourceHolder<Resource, Identifier>::load(Identifier id, const std::string
 	if (!resource->loadFromFile(filename, secondParam))
 		throw std::runtime_error("ResourceHolder::load - Failed to load " + filename);
 
-	// If loading successful, insert resource to map
-	insertResource(id, std::move(resource));
+	// If loading successful, insert resource to map; without the parameter it can't be reloaded
+	insertResource(id, std::move(resource), "");
+}
+
+template <typename Resource, typename Identifier>
+void ResourceHolder<Resource, Identifier>::loadAll(const FileList& files, LoadTimeline* timeline)
+{
+	typedef ResourceDecoder<Resource> Decoder;
+	const std::size_t MaxWorkers = 4;
+
+	// std::vector<bool> packs bits, so workers couldn't write their results independently
+	std::vector<typename Decoder::Decoded> decoded(files.size());
+	std::vector<char> decodedOk(files.size(), 0);
+	std::size_t nextFile = 0;
+	sf::Mutex mutex;
+
+	// Each worker takes the next file until none are left
+	auto decodeFiles = [&] (unsigned int thread)
+	{
+		for (;;)
+		{
+			std::size_t i;
+			{
+				sf::Lock lock(mutex);
+				i = nextFile++;
+			}
+
+			if (i >= files.size())
+				return;
+
+			sf::Time start = timeline ? timeline->now() : sf::Time::Zero;
+
+			const void* data;
+			std::size_t size;
+			if (findInPack(files[i].first, data, size))
+				decodedOk[i] = Decoder::decodeMemory(decoded[i], data, size);
+			else
+				decodedOk[i] = Decoder::decode(decoded[i], files[i].second);
+
+			if (timeline)
+				timeline->record(files[i].second, "decode", thread, start);
+		}
+	};
+
+	std::vector<std::unique_ptr<sf::Thread>> workers;
+	for (unsigned int thread = 1; thread <= std::min(files.size(), MaxWorkers); ++thread)
+	{
+		workers.push_back(std::unique_ptr<sf::Thread>(new sf::Thread(decodeFiles, thread)));
+		workers.back()->launch();
+	}
+
+	for (std::size_t i = 0; i < workers.size(); ++i)
+		workers[i]->wait();
+
+	// Finish in the given order on this thread
+	for (std::size_t i = 0; i < files.size(); ++i)
+	{
+		sf::Time start = timeline ? timeline->now() : sf::Time::Zero;
+
+		std::unique_ptr<Resource> resource;
+		if (decodedOk[i])
+			resource = Decoder::finish(decoded[i]);
+
+		if (!resource)
+			throw std::runtime_error("ResourceHolder::loadAll - Failed to load " + files[i].second);
+
+		if (timeline)
+			timeline->record(files[i].second, "finish", 0, start);
+
+		insertResource(files[i].first, std::move(resource), files[i].second);
+	}
 }
 
 template <typename Resource, typename Identifier>
 Resource& ResourceHolder<Resource, Identifier>::get(Identifier id)
 {
-	auto found = mResourceMap.find(id);
-	assert(found != mResourceMap.end());
+	Slot* slot = mStorage.find(id);
+	assert(slot && slot->resident);
 
-	return *found->second;
+	return *slot->resource;
 }
 
 template <typename Resource, typename Identifier>
 const Resource& ResourceHolder<Resource, Identifier>::get(Identifier id) const
 {
-	auto found = mResourceMap.find(id);
-	assert(found != mResourceMap.end());
+	const Slot* slot = mStorage.find(id);
+	assert(slot && slot->resident);
+
+	return *slot->resource;
+}
+
+template <typename Resource, typename Identifier>
+bool ResourceHolder<Resource, Identifier>::isLoaded(Identifier id) const
+{
+	return mStorage.find(id) != nullptr;
+}
+
+template <typename Resource, typename Identifier>
+void ResourceHolder<Resource, Identifier>::checkAllLoaded() const
+{
+	for (std::size_t i = 0; i < ResourceCount<Identifier>::value; ++i)
+	{
+		if (!isLoaded(static_cast<Identifier>(i)))
+			throw std::runtime_error("ResourceHolder::checkAllLoaded - No resource loaded for ID " + std::to_string(i));
+	}
+}
 
-	return *found->second;
+template <typename Resource, typename Identifier>
+void ResourceHolder<Resource, Identifier>::checkLoaded(Identifier first, Identifier last) const
+{
+	for (std::size_t i = first; i <= static_cast<std::size_t>(last); ++i)
+	{
+		if (!isLoaded(static_cast<Identifier>(i)))
+			throw std::runtime_error("ResourceHolder::checkLoaded - No resource loaded for ID " + std::to_string(i));
+	}
 }
 
 template <typename Resource, typename Identifier>
-void ResourceHolder<Resource, Identifier>::insertResource(Identifier id, std::unique_ptr<Resource> resource) 
+void ResourceHolder<Resource, Identifier>::insertResource(Identifier id, std::unique_ptr<Resource> resource, const std::string& filename) 
 {
+	std::unique_ptr<Slot> slot(new Slot());
+	slot->resource = std::move(resource);
+	slot->id = id;
+	slot->filename = filename;
+	slot->handle = 0;
+	slot->resident = true;
+
+	if (mBudget)
+	{
+		// Evicting swaps in an empty resource, so references handed out by get() stay valid;
+		// settings made after loading are kept in the slot until the reload
+		Slot* evicted = slot.get();
+		std::function<void()> evict;
+		if (!filename.empty())
+		{
+			evict = [evicted] ()
+			{
+				evicted->settings.save(*evicted->resource);
+				*evicted->resource = Resource();
+				evicted->resident = false;
+			};
+		}
+
+		slot->handle = mBudget->add(getResourceBytes(*slot->resource), evict);
+		mBudgetedSlots.push_back(slot.get());
+	}
+
 	// Insert and check success
-	auto inserted = mResourceMap.insert(std::make_pair(id, std::move(resource)));
-	assert(inserted.second);
+	bool inserted = mStorage.insert(id, std::move(slot));
+	assert(inserted);
+}
+
+template <typename Resource, typename Identifier>
+void ResourceHolder<Resource, Identifier>::reload(Slot& slot)
+{
+	sf::Clock reloadClock;
+	const void* data;
+	std::size_t size;
+
+	bool reloaded = findInPack(slot.id, data, size)
+		? ResourceDecoder<Resource>::loadMemory(*slot.resource, data, size)
+		: ResourceDecoder<Resource>::load(*slot.resource, slot.filename);
+
+	if (!reloaded)
+		throw std::runtime_error("ResourceHolder::setPinned - Failed to reload " + slot.filename);
+
+	slot.settings.apply(*slot.resource);
+	slot.resident = true;
+	mBudget->markReloaded(slot.handle, getResourceBytes(*slot.resource), reloadClock.getElapsedTime());
+}
+
+template <typename Resource, typename Identifier>
+bool ResourceHolder<Resource, Identifier>::findInPack(Identifier id, const void*& data, std::size_t& size) const
+{
+	return mPack && mPack->find(static_cast<Assets::Kind>(ResourceKind<Identifier>::value), id, data, size);
+}
+
+template <typename Value, typename Identifier, std::size_t Count>
+bool ResourceStorage<Value, Identifier, Count>::insert(Identifier id, std::unique_ptr<Value> value)
+{
+	assert(static_cast<std::size_t>(id) < Count);
+	if (mValues[id])
+		return false;
+
+	mValues[id] = std::move(value);
+	return true;
+}
+
+template <typename Value, typename Identifier, std::size_t Count>
+Value* ResourceStorage<Value, Identifier, Count>::find(Identifier id) const
+{
+	return mValues[id].get();
+}
+
+template <typename Value, typename Identifier>
+bool ResourceStorage<Value, Identifier, 0>::insert(Identifier id, std::unique_ptr<Value> value)
+{
+	return mValueMap.insert(std::make_pair(id, std::move(value))).second;
+}
+
+template <typename Value, typename Identifier>
+Value* ResourceStorage<Value, Identifier, 0>::find(Identifier id) const
+{
+	auto found = mValueMap.find(id);
+	return (found != mValueMap.end()) ? found->second.get() : nullptr;
 }
@@ -12,6 +12,7 @@ namespace sf
 
 namespace Textures
 {
+	// Each level's holder loads Eagle to FireRate, the application's holder the rest
 	enum ID
 	{
 		Eagle,
@@ -31,7 +32,8 @@ namespace Textures
 		TitleScreen,
 		ButtonNormal,
 		ButtonSelected,
-		ButtonPressed
+		ButtonPressed,
+		Count
 	};
 }
 
@@ -40,6 +42,7 @@ namespace Fonts
 	enum ID
 	{
 		Main,
+		Count
 	};
 }
 
@@ -54,6 +57,7 @@ namespace SoundEffect
 		LaunchMissile,
 		CollectPickup,
 		Button,
+		Count
 	};
 }
 
@@ -66,6 +70,39 @@ namespace Music
 	};
 }
 
+// Kinds of assets, so identifiers of different enums don't collide in the asset pack
+namespace Assets
+{
+	enum Kind
+	{
+		Textures,
+		Fonts,
+		Sounds,
+		Music,
+	};
+}
+
+// Number of values of identifiers that are dense enums (0 to Count - 1). ResourceHolder stores
+// their resources in a fixed array; other identifiers keep the default of 0 and use a map.
+template <typename Identifier>
+struct ResourceCount
+{
+	enum { value = 0 };
+};
+
+template <> struct ResourceCount<Textures::ID>		{ enum { value = Textures::Count }; };
+template <> struct ResourceCount<Fonts::ID>			{ enum { value = Fonts::Count }; };
+template <> struct ResourceCount<SoundEffect::ID>	{ enum { value = SoundEffect::Count }; };
+
+// Asset kind of each identifier enum
+template <typename Identifier>
+struct ResourceKind;
+
+template <> struct ResourceKind<Textures::ID>		{ enum { value = Assets::Textures }; };
+template <> struct ResourceKind<Fonts::ID>			{ enum { value = Assets::Fonts }; };
+template <> struct ResourceKind<SoundEffect::ID>	{ enum { value = Assets::Sounds }; };
+template <> struct ResourceKind<Music::ID>			{ enum { value = Assets::Music }; };
+
 // Forward declaration and a few type definitions
 template <typename Resource, typename Identifier>
 class ResourceHolder;
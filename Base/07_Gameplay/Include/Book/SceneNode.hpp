@@ -7,15 +7,16 @@
 #include <SFML/System/Time.hpp>
 #include <SFML/Graphics/Transformable.hpp>
 #include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/Rect.hpp>
 
 #include <vector>
-#include <set>
 #include <memory>
 #include <utility>
 
 
 struct Command;
 class CommandQueue;
+class RenderQueue;
 
 class SceneNode : public sf::Transformable, public sf::Drawable, private sf::NonCopyable
 {
@@ -41,32 +42,59 @@ class SceneNode : public sf::Transformable, public sf::Drawable, private sf::Non
 		void					onCommand(const Command& command, sf::Time dt);
 		virtual unsigned int	getCategory() const;
 
-		void					checkSceneCollision(SceneNode& sceneGraph, std::set<Pair>& collisionPairs);
-		void					checkNodeCollision(SceneNode& node, std::set<Pair>& collisionPairs);
 		void					removeWrecks();
 		virtual sf::FloatRect	getBoundingRect() const;
+
+		// Marks the subtrees outside area (world coordinates) to be skipped by draw(), using the
+		// interpolated transforms that are drawn; call once per frame, returns the subtrees culled.
+		// World bounds are cached per node and only recomputed after a transform or content change.
+		std::size_t				cull(const sf::FloatRect& area);
+
+		// Like draw(), but hands the drawables of the subtree to a queue that sorts them
+		void					enqueue(RenderQueue& queue, sf::RenderStates states) const;
 		virtual bool			isMarkedForRemoval() const;
 		virtual bool			isDestroyed() const;
 		bool					isEmpty();
 		void					pop();
 
+	protected:
+		// Area covered by drawCurrent(), in local coordinates; empty if the node draws nothing itself
+		virtual sf::FloatRect	getDrawBounds() const;
+		// Call when getDrawBounds() changes, so the next cull() recomputes it
+		void					invalidateBounds();
+
+		// Transform relative to the parent, by default the sf::Transformable one
+		virtual sf::Transform	getLocalTransform() const;
+
+		// Transform applied when drawing, by default the local one
+		virtual sf::Transform	getRenderTransform() const;
+
+
 	private:
 		virtual void			updateCurrent(sf::Time dt, CommandQueue& commands);
 		void					updateChildren(sf::Time dt, CommandQueue& commands);
 
 		virtual void			draw(sf::RenderTarget& target, sf::RenderStates states) const;
 		virtual void			drawCurrent(sf::RenderTarget& target, sf::RenderStates states) const;
+		virtual void			enqueueCurrent(RenderQueue& queue, sf::RenderStates states) const;
 		void					drawChildren(sf::RenderTarget& target, sf::RenderStates states) const;
 		void					drawBoundingRect(sf::RenderTarget& target, sf::RenderStates states) const;
+		std::size_t				cull(const sf::FloatRect& area, const sf::Transform& parentTransform, bool parentMoved);
 
 
 	private:
 		std::vector<Ptr>		mChildren;
 		SceneNode*				mParent;
 		Category::Type			mDefaultCategory;
+		sf::Transform			mRenderTransform;
+		sf::Transform			mWorldTransform;
+		sf::FloatRect			mDrawBounds;
+		sf::FloatRect			mCullBounds;
+		bool					mBoundsDirty;
+		bool					mBoundsChanged;
+		bool					mCulled;
 };
 
-bool	collision(const SceneNode& lhs, const SceneNode& rhs);
 float	distance(const SceneNode& lhs, const SceneNode& rhs);
 
 #endif // BOOK_SCENENODE_HPP
@@ -0,0 +1,31 @@
+#ifndef BOOK_SETTINGS_HPP
+#define BOOK_SETTINGS_HPP
+
+#include <SFML/System/Time.hpp>
+
+#include <cstddef>
+
+
+// Options of the main loop that can be changed at runtime from the settings menu
+class Settings
+{
+	public:
+								Settings();
+
+		// Simulation steps per second, cycling through 30, 60, 120 and 240 Hz
+		unsigned int			getTickRate() const;
+		sf::Time				getTimePerTick() const;
+		void					selectNextTickRate();
+
+		// Frames per second the loop sleeps down to; 0 renders as fast as possible
+		unsigned int			getRenderRate() const;
+		sf::Time				getTimePerRender() const;
+		void					selectNextRenderRate();
+
+
+	private:
+		std::size_t				mTickRateIndex;
+		std::size_t				mRenderRateIndex;
+};
+
+#endif // BOOK_SETTINGS_HPP
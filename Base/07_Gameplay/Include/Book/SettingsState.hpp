@@ -18,7 +18,7 @@ class SettingsState : public State
 	public:
 										SettingsState(StateStack& stack, Context context);
 
-		virtual void					draw();
+		virtual void					draw(float interpolation);
 		virtual bool					update(sf::Time dt);
 		virtual bool					handleEvent(const sf::Event& event);
 
@@ -28,11 +28,14 @@ class SettingsState : public State
 		void							addButtonLabel(Player::Action action, float x, float y, const std::string& text, Context context);
 		void							hideControlButtons(bool flag);
 		void							addControlButtons(Context& context);
+		void							updateRenderRateText();
 
 	private:
 		sf::Sprite											mBackgroundSprite;
 		GUI::Container										mGUIContainer;
 		std::shared_ptr<GUI::Button>						mChangeControlButton;
+		GUI::Button::Ptr									mTickRateButton;
+		GUI::Button::Ptr									mRenderRateButton;
 		std::array<GUI::Button::Ptr, Player::ActionCount>	mBindingButtons;
 		std::array<GUI::Label::Ptr, Player::ActionCount> 	mBindingLabels;
 };
@@ -0,0 +1,51 @@
+#ifndef BOOK_SOUNDEVENTBUFFER_HPP
+#define BOOK_SOUNDEVENTBUFFER_HPP
+
+#include <Book/ResourceIdentifiers.hpp>
+
+#include <SFML/System/Time.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <SFML/Graphics/Rect.hpp>
+
+#include <vector>
+
+
+class SoundPlayer;
+
+// Collects the sound effects requested during a tick and plays them in one go. Effects
+// well outside the view are culled, and effects close to one of the same kind started
+// shortly before are merged into it, so neither takes a voice.
+class SoundEventBuffer
+{
+	public:
+									SoundEventBuffer();
+
+		void						push(SoundEffect::ID effect, sf::Vector2f position);
+
+		// Plays the pending effects that are neither culled nor merged; counts are per flush
+		void						flush(SoundPlayer& player, const sf::FloatRect& viewBounds, sf::Time dt);
+		std::size_t					getCulledCount() const;
+		std::size_t					getMergedCount() const;
+
+
+	private:
+		struct Event
+		{
+			SoundEffect::ID			effect;
+			sf::Vector2f			position;
+			sf::Time				age;
+		};
+
+
+	private:
+		bool						isMerged(const Event& event) const;
+
+
+	private:
+		std::vector<Event>			mPending;
+		std::vector<Event>			mRecent;
+		std::size_t					mCulledCount;
+		std::size_t					mMergedCount;
+};
+
+#endif // BOOK_SOUNDEVENTBUFFER_HPP
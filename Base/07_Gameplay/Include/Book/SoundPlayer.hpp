@@ -9,25 +9,60 @@
 #include <SFML/Audio/SoundBuffer.hpp>
 #include <SFML/Audio/Sound.hpp>
 
-#include <list>
+#include <vector>
 
 
 class SoundPlayer : private sf::NonCopyable
 {
 	public:
-									SoundPlayer();
+									SoundPlayer(const AssetPack& pack, LoadTimeline& timeline);
 
 		void						play(SoundEffect::ID effect);
 		void						play(SoundEffect::ID effect, sf::Vector2f position);
 
 		void						removeStoppedSounds();
+
+		// While muted, new effects are dropped and playing ones are paused until unmuted
+		void						setMuted(bool muted);
+		// Limits the voices in use, at most PoolSize; voices above the limit are stopped
+		void						setMaxVoices(std::size_t maxVoices);
 		void						setListenerPosition(sf::Vector2f position);
 		sf::Vector2f				getListenerPosition() const;
+		// Volume factor at the listener of an effect played at this position, 1 when close
+		float						getGain(sf::Vector2f position) const;
+
+		std::size_t					getActiveVoices() const;
+		std::size_t					getMaxVoices() const;
+		// Voices taken over from a playing effect, and effects dropped for lack of a voice
+		std::size_t					getStealCount() const;
+		std::size_t					getDropCount() const;
+
+		static const std::size_t	PoolSize;
+
+
+	private:
+		struct Voice
+		{
+									Voice();
+
+			sf::Sound				sound;
+			int						priority;
+			bool					active;
+		};
+
+
+	private:
+		Voice*						findVoice(int priority);
 
 
 	private:
 		SoundBufferHolder			mSoundBuffers;
-		std::list<sf::Sound>		mSounds;
+		std::vector<Voice>			mVoices;
+		bool						mMuted;
+		std::size_t					mMaxVoices;
+		std::size_t					mActiveVoices;
+		std::size_t					mStealCount;
+		std::size_t					mDropCount;
 };
 
 #endif // BOOK_SOUNDPLAYER_HPP
@@ -15,6 +15,8 @@ class SpriteNode : public SceneNode
 
 	private:
 		virtual void		drawCurrent(sf::RenderTarget& target, sf::RenderStates states) const;
+		virtual void		enqueueCurrent(RenderQueue& queue, sf::RenderStates states) const;
+		virtual sf::FloatRect	getDrawBounds() const;
 
 
 	private:
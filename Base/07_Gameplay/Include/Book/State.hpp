@@ -19,6 +19,13 @@ class StateStack;
 class Player;
 class MusicPlayer;
 class SoundPlayer;
+class Profiler;
+class Settings;
+class RenderStatistics;
+class QualityGovernor;
+class ResolutionScaler;
+class ResourceBudget;
+class AssetPack;
 
 class State
 {
@@ -28,7 +35,9 @@ class State
 		struct Context
 		{
 								Context(sf::RenderWindow& window, TextureHolder& textures, FontHolder& fonts, Player& player,
-									MusicPlayer& music, SoundPlayer& sounds);
+									MusicPlayer& music, SoundPlayer& sounds, Profiler& profiler, Settings& settings,
+									RenderStatistics& statistics, QualityGovernor& quality, ResolutionScaler& resolution,
+									ResourceBudget& textureBudget, const AssetPack& assets);
 
 			sf::RenderWindow*	window;
 			TextureHolder*		textures;
@@ -36,6 +45,13 @@ class State
 			Player*				player;
 			MusicPlayer*		music;
 			SoundPlayer*		sounds;
+			Profiler*			profiler;
+			Settings*			settings;
+			RenderStatistics*	statistics;
+			QualityGovernor*	quality;
+			ResolutionScaler*	resolution;
+			ResourceBudget*		textureBudget;
+			const AssetPack*	assets;
 		};
 
 
@@ -43,22 +59,38 @@ class State
 							State(StateStack& stack, Context context);
 		virtual				~State();
 
-		virtual void		draw() = 0;
+		// interpolation: fraction of a simulation tick elapsed since the last update, 0 to 1
+		virtual void		draw(float interpolation) = 0;
 		virtual bool		update(sf::Time dt) = 0;
 		virtual bool		handleEvent(const sf::Event& event) = 0;
 
+		// False if the last drawing of the state is still up to date
+		bool				isDirty() const;
+		void				markDrawn();
+
+		// True if the state covers the whole window, hiding the states below it
+		bool				isOpaque() const;
+
 
 	protected:
 		void				requestStackPush(States::ID stateID);
 		void				requestStackPop();
 		void				requestStateClear();
 
+		// States that only change on events or timers are drawn on demand, after invalidate()
+		void				enableDrawOnDemand();
+		void				invalidate();
+		void				setOpaque(bool flag);
+
 		Context				getContext() const;
 
 
 	private:
 		StateStack*			mStack;
 		Context				mContext;
+		bool				mDrawOnDemand;
+		bool				mDirty;
+		bool				mOpaque;
 };
 
 #endif // BOOK_STATE_HPP
@@ -13,7 +13,8 @@ namespace States
 		Loading,
 		Pause,
 		Settings,
-		GameOver
+		GameOver,
+		Count
 	};
 }
 
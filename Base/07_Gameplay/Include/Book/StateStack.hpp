@@ -38,7 +38,7 @@ class StateStack : private sf::NonCopyable
 		void				registerState(States::ID stateID);
 
 		void				update(sf::Time dt);
-		void				draw();
+		void				draw(float interpolation);
 		void				handleEvent(const sf::Event& event);
 
 		void				pushState(States::ID stateID);
@@ -47,9 +47,13 @@ class StateStack : private sf::NonCopyable
 
 		bool				isEmpty() const;
 
+		// True if draw() would produce a different picture than last time
+		bool				isDirty() const;
+
 
 	private:
 		State::Ptr			createState(States::ID stateID);
+		std::size_t			getFirstVisibleState() const;
 		void				applyPendingChanges();
 
 
@@ -65,10 +69,12 @@ class StateStack : private sf::NonCopyable
 
 	private:
 		std::vector<State::Ptr>								mStack;
+		std::vector<States::ID>								mStackIDs;
 		std::vector<PendingChange>							mPendingList;
 
 		State::Context										mContext;
 		std::map<States::ID, std::function<State::Ptr()>>	mFactories;
+		bool												mChanged;
 };
 
 
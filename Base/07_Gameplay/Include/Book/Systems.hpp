@@ -0,0 +1,36 @@
+#ifndef BOOK_SYSTEMS_HPP
+#define BOOK_SYSTEMS_HPP
+
+#include <Book/Components.hpp>
+#include <Book/Collision.hpp>
+
+#include <SFML/System/Time.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+
+#include <vector>
+
+
+class EntityRegistry;
+class Profiler;
+class RenderQueue;
+
+namespace sf
+{
+	class RenderTarget;
+}
+
+// Linear passes over the packed component arrays of an EntityRegistry
+namespace Systems
+{
+	sf::FloatRect	computeBoundingRect(const Components::Transform& transform, const Components::Sprite& sprite);
+	sf::Vector2f	computeTextureCenter(const Components::Transform& transform, const sf::Sprite& sprite);
+	sf::Vector2f	interpolatePosition(const Components::Transform& transform, float interpolation);
+
+	void			updateMovementPatterns(EntityRegistry& registry, sf::Time dt);
+	void			integrateVelocities(EntityRegistry& registry, sf::Time dt);
+	void			updateColliders(EntityRegistry& registry);
+	void			findCollisions(const EntityRegistry& registry, std::vector<Collision::Contact>& contacts, Profiler& profiler);
+	std::size_t		enqueueSprites(const EntityRegistry& registry, RenderQueue& queue, const sf::FloatRect& area);
+}
+
+#endif // BOOK_SYSTEMS_HPP
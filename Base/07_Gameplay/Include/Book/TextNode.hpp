@@ -4,6 +4,7 @@
 #include <Book/ResourceHolder.hpp>
 #include <Book/ResourceIdentifiers.hpp>
 #include <Book/SceneNode.hpp>
+#include <Book/RenderQueue.hpp>
 
 #include <SFML/Graphics/Text.hpp>
 #include <SFML/Graphics/Font.hpp>
@@ -15,14 +16,20 @@ class TextNode : public SceneNode
 		explicit			TextNode(const FontHolder& fonts, const std::string& text);
 
 		void				setString(const std::string& text);
+		// Layer the text is queued in; Overlay by default
+		void				setLayer(RenderQueue::Layer layer);
 
 
 	private:
 		virtual void		drawCurrent(sf::RenderTarget& target, sf::RenderStates states) const;
+		virtual void		enqueueCurrent(RenderQueue& queue, sf::RenderStates states) const;
+		virtual sf::FloatRect	getDrawBounds() const;
 
 
 	private:
 		sf::Text			mText;
+		sf::FloatRect		mBounds;
+		RenderQueue::Layer	mLayer;
 };
 
 #endif // BOOK_TEXTNODE_HPP
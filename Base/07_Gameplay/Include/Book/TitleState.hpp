@@ -12,7 +12,7 @@ class TitleState : public State
 	public:
 							TitleState(StateStack& stack, Context context);
 
-		virtual void		draw();
+		virtual void		draw(float interpolation);
 		virtual bool		update(sf::Time dt);
 		virtual bool		handleEvent(const sf::Event& event);
 
@@ -3,6 +3,7 @@
 
 #include <SFML/Window/Keyboard.hpp>
 #include <SFML/System/Vector2.hpp>
+#include <SFML/Graphics/Rect.hpp>
 
 #include <sstream>
 
@@ -36,6 +37,9 @@ int				randomInt(int exclusiveMax);
 float			length(sf::Vector2f vector);
 sf::Vector2f	unitVector(sf::Vector2f vector);
 
+// Smallest rectangle containing both; an empty rectangle contributes nothing
+sf::FloatRect	unite(const sf::FloatRect& lhs, const sf::FloatRect& rhs);
+
 
 #include <Book/Utility.inl>
 #endif // BOOK_UTILITY_HPP
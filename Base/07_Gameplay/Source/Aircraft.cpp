@@ -3,13 +3,8 @@
 #include <Book/Utility.hpp>
 #include <Book/Pickup.hpp>
 #include <Book/CommandQueue.hpp>
-#include <Book/SoundNode.hpp>
 #include <Book/ResourceHolder.hpp>
 
-#include <SFML/Graphics/RenderTarget.hpp>
-#include <SFML/Graphics/RenderStates.hpp>
-#include <SFML/Graphics/RenderWindow.hpp>
-
 #include <cmath>
 
 
@@ -18,65 +13,54 @@ namespace
 	const std::vector<AircraftData> Table = initializeAircraftData();
 }
 
-Aircraft::Aircraft(Type type, const TextureHolder& textures, const FontHolder& fonts, sf::RenderWindow& window, unsigned int difficulty)
-	: Entity(Table[type].hitpoints)
+Aircraft::Aircraft(Type type, const TextureHolder& textures, const FontHolder& fonts, EntityRegistry& registry, unsigned int difficulty)
+	: Entity(registry, Table[type].hitpoints)
 	, mType(type)
-	, mSprite(textures.get(Table[type].texture))
-	, mFireCommand()
-	, mMissileCommand()
-	, mFireCountdown(sf::Time::Zero)
-	, mIsFiring(false)
-	, mIsLaunchingMissile(false)
+	, mSeek()
+	, mTextures(textures)
 	, mIsMarkedForRemoval(false)
 	, mPlayedExplosionSound(false)
-	, mFireRateLevel(1)
-	, mSpreadLevel(1)
-	, mMissileAmmo(2)
-	, mEnergy(20)
-	, mDropPickupCommand()
-	, mTravelledDistance(0.f)
-	, mDirectionIndex(0)
+	, mDifficulty(difficulty)
 	, mHealthDisplay(nullptr)
 	, mMissileDisplay(nullptr)
 	, mEnergyDisplay(nullptr)
-	, mSeek()
 	, mSeekRadius(20)
-	, mWindow(window)
-	, mDifficulty(difficulty)
 	, mStickDirection()
 	, mStickSensitivity(0.1f)
 {
-	centerOrigin(mSprite);
+	setSprite(sf::Sprite(textures.get(Table[type].texture)));
+	centerOrigin(getSprite());
 
 	// initialize seek
 	mSeek.isSeek = false;
 	mSeek.target = sf::Vector2i();
 
-	mFireCommand.category = Category::SceneAirLayer;
-	mFireCommand.action = [this, &textures](SceneNode& node, sf::Time)
-	{
-		createBullets(node, textures);
-	};
-
-	mMissileCommand.category = Category::SceneAirLayer;
-	mMissileCommand.action = [this, &textures](SceneNode& node, sf::Time)
-	{
-		createProjectile(node, Projectile::Missile, 0.f, 0.5f, textures);
-	};
-
-	mEnergyCommand.category = Category::SceneAirLayer;
-	mEnergyCommand.action = [this, &textures](SceneNode& node, sf::Time)
-	{
-		createProjectile(node, Projectile::EnergyBall, 0.f, 0.5f, textures);
-	};
-
-	mDropPickupCommand.category = Category::SceneAirLayer;
-	mDropPickupCommand.action = [this, &textures](SceneNode& node, sf::Time)
+	Components::Weapon weapon;
+	weapon.fireInterval = Table[type].fireInterval;
+	weapon.fireCountdown = sf::Time::Zero;
+	weapon.fireRateLevel = 1;
+	weapon.spreadLevel = 1;
+	weapon.missileAmmo = 2;
+	weapon.energy = 20;
+	weapon.isFiring = false;
+	weapon.isLaunchingMissile = false;
+	weapon.isLaunchingEnergy = false;
+	registry.getWeapons().insert(getID(), weapon);
+
+	// Enemy airplanes follow a movement pattern
+	if (!Table[type].directions.empty())
 	{
-		createPickup(node, textures);
-	};
+		Components::MovementPattern pattern;
+		pattern.directions = &Table[type].directions;
+		pattern.speed = getMaxSpeed();
+		pattern.travelledDistance = 0.f;
+		pattern.directionIndex = 0;
+		registry.getMovementPatterns().insert(getID(), pattern);
+	}
 
 	std::unique_ptr<TextNode> healthDisplay(new TextNode(fonts, ""));
+	if (!isAllied())
+		healthDisplay->setLayer(RenderQueue::Details);
 	mHealthDisplay = healthDisplay.get();
 	attachChild(std::move(healthDisplay));
 
@@ -99,11 +83,6 @@ Aircraft::Aircraft(Type type, const TextureHolder& textures, const FontHolder& f
 	updateTexts();
 }
 
-void Aircraft::drawCurrent(sf::RenderTarget& target, sf::RenderStates states) const
-{
-	target.draw(mSprite, states);
-}
-
 void Aircraft::updateCurrent(sf::Time dt, CommandQueue& commands)
 {
 	// Entity has been destroyed: Possibly drop pickup, mark for removal
@@ -135,21 +114,17 @@ void Aircraft::updateCurrent(sf::Time dt, CommandQueue& commands)
 		accelerate(mStickDirection*getMaxSpeed());
 	}
 
-	// Check if bullets or missiles are fired
+	// Check if bullets or missiles are fired; movement is applied by the systems
 	checkProjectileLaunch(dt, commands);
 
-	// Update enemy movement pattern; apply velocity
-	updateMovementPattern(dt);
-	Entity::updateCurrent(dt, commands);
-
 	// Update texts
 	updateTexts();
 }
 
-void Aircraft::setSeek()
+void Aircraft::setSeek(sf::Vector2i target)
 {
 	mSeek.isSeek = true;
-	mSeek.target = sf::Mouse::getPosition(mWindow);
+	mSeek.target = target;
 }
 
 void Aircraft::seekTarget(sf::Vector2f pos, sf::Vector2f targetPos)
@@ -194,11 +169,6 @@ unsigned int Aircraft::getCategory() const
 		return Category::EnemyAircraft;
 }
 
-sf::FloatRect Aircraft::getBoundingRect() const
-{
-	return getWorldTransform().transformRect(mSprite.getGlobalBounds());
-}
-
 bool Aircraft::isMarkedForRemoval() const
 {
 	return mIsMarkedForRemoval;
@@ -216,65 +186,60 @@ float Aircraft::getMaxSpeed() const
 
 void Aircraft::increaseFireRate()
 {
-	if (mFireRateLevel < 10)
-		++mFireRateLevel;
+	Components::Weapon& weapon = getWeapon();
+	if (weapon.fireRateLevel < 10)
+		++weapon.fireRateLevel;
 }
 
 void Aircraft::increaseSpread()
 {
-	if (mSpreadLevel < 3)
-		++mSpreadLevel;
+	Components::Weapon& weapon = getWeapon();
+	if (weapon.spreadLevel < 3)
+		++weapon.spreadLevel;
 }
 
 void Aircraft::collectMissiles(unsigned int count)
 {
-	mMissileAmmo += count;
+	getWeapon().missileAmmo += count;
 }
 
 void Aircraft::collectEnergy(unsigned int count)
 {
-	mEnergy += count;
+	getWeapon().energy += count;
 }
 
 void Aircraft::fire()
 {
 	// Only ships with fire interval != 0 are able to fire
-	if (Table[mType].fireInterval != sf::Time::Zero)
-		mIsFiring = true;
+	Components::Weapon& weapon = getWeapon();
+	if (weapon.fireInterval != sf::Time::Zero)
+		weapon.isFiring = true;
 }
 
 void Aircraft::launchMissile()
 {
-	if (mMissileAmmo > 0)
+	Components::Weapon& weapon = getWeapon();
+	if (weapon.missileAmmo > 0)
 	{
-		mIsLaunchingMissile = true;
-		--mMissileAmmo;
+		weapon.isLaunchingMissile = true;
+		--weapon.missileAmmo;
 	}
 }
 
 void Aircraft::launchEnergy()
 {
-	if (mEnergy > 0)
+	Components::Weapon& weapon = getWeapon();
+	if (weapon.energy > 0)
 	{
-		mIsLaunchingEnergy = true;
-		--mEnergy;
+		weapon.isLaunchingEnergy = true;
+		--weapon.energy;
 	}
 
 }
 
 void Aircraft::playLocalSound(CommandQueue& commands, SoundEffect::ID effect)
 {
-	sf::Vector2f worldPosition = getWorldPosition();
-	
-	Command command;
-	command.category = Category::SoundEffect;
-	command.action = derivedAction<SoundNode>(
-		[effect, worldPosition] (SoundNode& node, sf::Time)
-		{
-			node.playSound(effect, worldPosition);
-		});
-
-	commands.push(command);
+	commands.getSoundEvents().push(effect, getWorldPosition());
 }
 
 void Aircraft::moveToStick() {
@@ -304,105 +269,113 @@ bool Aircraft::isStick()
 	return 0;
 }
 
-void Aircraft::updateMovementPattern(sf::Time dt)
+void Aircraft::checkPickupDrop(CommandQueue& commands)
 {
-	// Enemy airplane: Movement pattern
-	const std::vector<Direction>& directions = Table[mType].directions;
-	if (!directions.empty())
+	if (!isAllied() && randomInt(3) == 0)
 	{
-		// Moved long enough in current direction: Change direction
-		if (mTravelledDistance > directions[mDirectionIndex].distance)
+		Command dropPickupCommand;
+		dropPickupCommand.category = Category::SceneAirLayer;
+		dropPickupCommand.action = [this] (SceneNode& node, sf::Time)
 		{
-			mDirectionIndex = (mDirectionIndex + 1) % directions.size();
-			mTravelledDistance = 0.f;
-		}
-
-		// Compute velocity from direction
-		float radians = toRadian(directions[mDirectionIndex].angle + 90.f);
-		float vx = getMaxSpeed() * std::cos(radians);
-		float vy = getMaxSpeed() * std::sin(radians);
+			createPickup(node);
+		};
 
-		setVelocity(vx, vy);
-
-		mTravelledDistance += getMaxSpeed() * dt.asSeconds();
+		commands.push(dropPickupCommand);
 	}
 }
 
-void Aircraft::checkPickupDrop(CommandQueue& commands)
-{
-	if (!isAllied() && randomInt(3) == 0)
-		commands.push(mDropPickupCommand);
-}
-
 void Aircraft::checkProjectileLaunch(sf::Time dt, CommandQueue& commands)
 {
 	// Enemies try to fire all the time
 	if (!isAllied())
 		fire();
 
+	Components::Weapon& weapon = getWeapon();
+
 	// Check for automatic gunfire, allow only in intervals
-	if (mIsFiring && mFireCountdown <= sf::Time::Zero)
+	if (weapon.isFiring && weapon.fireCountdown <= sf::Time::Zero)
 	{
 		// Interval expired: We can fire a new bullet
-		commands.push(mFireCommand);
+		Command fireCommand;
+		fireCommand.category = Category::SceneAirLayer;
+		fireCommand.action = [this] (SceneNode& node, sf::Time)
+		{
+			createBullets(node);
+		};
+
+		commands.push(fireCommand);
 		playLocalSound(commands, isAllied() ? SoundEffect::AlliedGunfire : SoundEffect::EnemyGunfire);
 		
-		mFireCountdown += Table[mType].fireInterval / (mFireRateLevel + 1.f);
-		mIsFiring = false;
-	} else if (mFireCountdown > sf::Time::Zero)
+		weapon.fireCountdown += weapon.fireInterval / (weapon.fireRateLevel + 1.f);
+		weapon.isFiring = false;
+	} else if (weapon.fireCountdown > sf::Time::Zero)
 	{
 		// Interval not expired: Decrease it further
-		mFireCountdown -= dt;
-		mIsFiring = false;
+		weapon.fireCountdown -= dt;
+		weapon.isFiring = false;
 	}
 
 	// Check for missile launch
-	if (mIsLaunchingMissile)
+	if (weapon.isLaunchingMissile)
 	{
-		commands.push(mMissileCommand);
+		commands.push(makeProjectileCommand(Projectile::Missile));
 		playLocalSound(commands, SoundEffect::LaunchMissile);
 		
-		mIsLaunchingMissile = false;
+		weapon.isLaunchingMissile = false;
 	}
 
 	// Check for energy launch
-	if (mIsLaunchingEnergy)
+	if (weapon.isLaunchingEnergy)
 	{
-		commands.push(mEnergyCommand);
+		commands.push(makeProjectileCommand(Projectile::EnergyBall));
 		playLocalSound(commands, SoundEffect::LaunchMissile);
 		
-		mIsLaunchingEnergy = false;
+		weapon.isLaunchingEnergy = false;
 	}
 }
 
-void Aircraft::createBullets(SceneNode& node, const TextureHolder& textures) const
+Command Aircraft::makeProjectileCommand(Projectile::Type type) const
+{
+	// Commands are built when needed, instead of being stored in every aircraft
+	Command command;
+	command.category = Category::SceneAirLayer;
+	command.action = [this, type] (SceneNode& node, sf::Time)
+	{
+		createProjectile(node, type, 0.f, 0.5f);
+	};
+
+	return command;
+}
+
+void Aircraft::createBullets(SceneNode& node) const
 {
 	Projectile::Type type = isAllied() ? Projectile::AlliedBullet : Projectile::EnemyBullet;
 
-	switch (mSpreadLevel)
+	switch (getWeapon().spreadLevel)
 	{
 	case 1:
-		createProjectile(node, type, 0.0f, 0.5f, textures);
+		createProjectile(node, type, 0.0f, 0.5f);
 		break;
 
 	case 2:
-		createProjectile(node, type, -0.33f, 0.33f, textures);
-		createProjectile(node, type, +0.33f, 0.33f, textures);
+		createProjectile(node, type, -0.33f, 0.33f);
+		createProjectile(node, type, +0.33f, 0.33f);
 		break;
 
 	case 3:
-		createProjectile(node, type, -0.5f, 0.33f, textures);
-		createProjectile(node, type, 0.0f, 0.5f, textures);
-		createProjectile(node, type, +0.5f, 0.33f, textures);
+		createProjectile(node, type, -0.5f, 0.33f);
+		createProjectile(node, type, 0.0f, 0.5f);
+		createProjectile(node, type, +0.5f, 0.33f);
 		break;
 	}
 }
 
-void Aircraft::createProjectile(SceneNode& node, Projectile::Type type, float xOffset, float yOffset, const TextureHolder& textures) const
+void Aircraft::createProjectile(SceneNode& node, Projectile::Type type, float xOffset, float yOffset) const
 {
-	std::unique_ptr<Projectile> projectile(new Projectile(type, textures));
+	std::unique_ptr<Projectile> projectile(new Projectile(type, mTextures, getRegistry()));
 
-	sf::Vector2f offset(xOffset * mSprite.getGlobalBounds().width, yOffset * mSprite.getGlobalBounds().height);
+	sf::FloatRect bounds = getSprite().getGlobalBounds();
+	sf::Vector2f offset(xOffset * bounds.width, yOffset * bounds.height);
 	sf::Vector2f velocity(0, projectile->getMaxSpeed());
 
 	float sign = isAllied() ? -1.f : +1.f;
@@ -411,34 +384,46 @@ void Aircraft::createProjectile(SceneNode& node, Projectile::Type type, float xO
 	node.attachChild(std::move(projectile));
 }
 
-void Aircraft::createPickup(SceneNode& node, const TextureHolder& textures) const
+void Aircraft::createPickup(SceneNode& node) const
 {
 	auto type = static_cast<Pickup::Type>(randomInt(Pickup::TypeCount));
 
-	std::unique_ptr<Pickup> pickup(new Pickup(type, textures));
+	std::unique_ptr<Pickup> pickup(new Pickup(type, mTextures, getRegistry()));
 	pickup->setPosition(getWorldPosition());
 	pickup->setVelocity(0.f, 1.f);
 	node.attachChild(std::move(pickup));
 }
 
+Components::Weapon& Aircraft::getWeapon()
+{
+	return getRegistry().getWeapons().get(getID());
+}
+
+const Components::Weapon& Aircraft::getWeapon() const
+{
+	return getRegistry().getWeapons().get(getID());
+}
+
 void Aircraft::updateTexts()
 {
+	const Components::Weapon& weapon = getWeapon();
+
 	mHealthDisplay->setString(toString(getHitpoints()) + " HP");
 	mHealthDisplay->setPosition(0.f, 50.f);
 	mHealthDisplay->setRotation(-getRotation());
 
 	if (mMissileDisplay)
 	{
-		if (mMissileAmmo == 0)
+		if (weapon.missileAmmo == 0)
 			mMissileDisplay->setString("");
 		else
-			mMissileDisplay->setString("M: " + toString(mMissileAmmo));
+			mMissileDisplay->setString("M: " + toString(weapon.missileAmmo));
 	}
 	if (mEnergyDisplay)
 	{
-		if (mEnergy == 0)
+		if (weapon.energy == 0)
 			mEnergyDisplay->setString("");
 		else
-			mEnergyDisplay->setString("E: " + toString(mEnergy));
+			mEnergyDisplay->setString("E: " + toString(weapon.energy));
 	}
 }
@@ -1,5 +1,6 @@
 #include <Book/Application.hpp>
 #include <Book/Utility.hpp>
+#include <Book/CountingTarget.hpp>
 #include <Book/State.hpp>
 #include <Book/StateIdentifiers.hpp>
 #include <Book/TitleState.hpp>
@@ -9,29 +10,64 @@
 #include <Book/SettingsState.hpp>
 #include <Book/GameOverState.hpp>
 
+#include <SFML/System/Sleep.hpp>
 
-const sf::Time Application::TimePerFrame = sf::seconds(1.f/60.f);
+
+const std::size_t Application::MaxTicksPerFrame = 10;
+const sf::Time Application::SpinThreshold = sf::milliseconds(2);
+const sf::Time Application::BackgroundTimePerRender = sf::seconds(0.1f);
+// Enough for the textures of the menus and one level; each level holds about 26 MB
+const std::size_t Application::TextureBudgetBytes = 40 * 1024 * 1024;
 
 Application::Application()
-: mWindow(sf::VideoMode(1024, 768), "Gameplay", sf::Style::Close)
+: mLoadTimeline()
+, mAssetPack("Media.pack")
+, mWindow(sf::VideoMode(1024, 768), "Gameplay", sf::Style::Close)
+, mTextureBudget(TextureBudgetBytes)
 , mTextures()
 , mFonts()
 , mPlayer()
-, mMusic()
-, mSounds()
-, mStateStack(State::Context(mWindow, mTextures, mFonts, mPlayer, mMusic, mSounds))
+, mMusic(mAssetPack)
+, mSounds(mAssetPack, mLoadTimeline)
+, mProfiler()
+, mSettings()
+, mRenderStatistics()
+, mQualityGovernor()
+, mResolutionScaler()
+, mStateStack(State::Context(mWindow, mTextures, mFonts, mPlayer, mMusic, mSounds, mProfiler, mSettings, mRenderStatistics, mQualityGovernor, mResolutionScaler, mTextureBudget, mAssetPack))
+, mHasFocus(true)
+, mPacingClock()
+, mFrameDeadline()
 , mStatisticsText()
 , mStatisticsUpdateTime()
 , mStatisticsNumFrames(0)
+, mStatisticsIdleTime()
+, mRedrawRequested(true)
 {
 	mWindow.setKeyRepeatEnabled(false);
 
-	mFonts.load(Fonts::Main, 	"Media/Sansation.ttf");
+	FontHolder::FileList fonts;
+	fonts.push_back(std::make_pair(Fonts::Main, 	"Media/Sansation.ttf"));
+	mFonts.setPack(mAssetPack);
+	mFonts.loadAll(fonts, &mLoadTimeline);
+	mFonts.checkAllLoaded();
+
+	sf::Time glyphsStart = mLoadTimeline.now();
+	mRenderStatistics.getGlyphs().prewarm(mFonts.get(Fonts::Main));
+	mLoadTimeline.record("Sansation.ttf", "glyphs", 0, glyphsStart);
+
+	// Buttons and the title screen keep references to their textures for the whole run
+	TextureHolder::FileList textures;
+	textures.push_back(std::make_pair(Textures::TitleScreen,		"Media/Textures/TitleScreen.png"));
+	textures.push_back(std::make_pair(Textures::ButtonNormal,		"Media/Textures/ButtonNormal.png"));
+	textures.push_back(std::make_pair(Textures::ButtonSelected,	"Media/Textures/ButtonSelected.png"));
+	textures.push_back(std::make_pair(Textures::ButtonPressed,		"Media/Textures/ButtonPressed.png"));
 
-	mTextures.load(Textures::TitleScreen,		"Media/Textures/TitleScreen.png");
-	mTextures.load(Textures::ButtonNormal,		"Media/Textures/ButtonNormal.png");
-	mTextures.load(Textures::ButtonSelected,	"Media/Textures/ButtonSelected.png");
-	mTextures.load(Textures::ButtonPressed,		"Media/Textures/ButtonPressed.png");
+	mTextures.setBudget(mTextureBudget);
+	mTextures.setPack(mAssetPack);
+	mTextures.loadAll(textures, &mLoadTimeline);
+	mTextures.checkLoaded(Textures::TitleScreen, Textures::ButtonPressed);
+	mTextures.setPinned(true);
 
 	mStatisticsText.setFont(mFonts.get(Fonts::Main));
 	mStatisticsText.setPosition(5.f, 5.f);
@@ -39,8 +75,12 @@ Application::Application()
 
 	registerStates();
 	mStateStack.pushState(States::Title);
+
+	// Cold-start metric: per-asset decode and upload times up to here
+	mLoadTimeline.writeToFile("StartupTimeline.csv");
 	
 	mMusic.setVolume(25.f);
+	mSounds.setMaxVoices(mQualityGovernor.getMaxVoices());
 }
 
 void Application::run()
@@ -51,21 +91,41 @@ void Application::run()
 	while (mWindow.isOpen())
 	{
 		sf::Time dt = clock.restart();
+		sf::Clock frameClock;
+		sf::Time timePerTick = mSettings.getTimePerTick();
+		std::size_t ticks = 0;
+
 		timeSinceLastUpdate += dt;
-		while (timeSinceLastUpdate > TimePerFrame)
+		while (timeSinceLastUpdate > timePerTick)
 		{
-			timeSinceLastUpdate -= TimePerFrame;
+			// After a stall, drop the backlog instead of running a burst of updates that stalls again
+			if (ticks == MaxTicksPerFrame)
+			{
+				timeSinceLastUpdate = sf::Time::Zero;
+				break;
+			}
+
+			timeSinceLastUpdate -= timePerTick;
+			++ticks;
 
 			processInput();
-			update(TimePerFrame);
+			update(timePerTick);
 
 			// Check inside this loop, because stack might be empty before update() call
 			if (mStateStack.isEmpty())
 				mWindow.close();
 		}
 
+		// Draw the world at the share of the next tick already accumulated
+		float interpolation = timeSinceLastUpdate / timePerTick;
+
+		mTextureBudget.enforce();
 		updateStatistics(dt);
-		render();
+		bool drawn = render(interpolation);
+		if (drawn)
+			updateQuality(frameClock.getElapsedTime());
+
+		waitForNextFrame(drawn ? sf::Time::Zero : timePerTick - timeSinceLastUpdate);
 	}
 }
 
@@ -78,6 +138,23 @@ void Application::processInput()
 
 		if (event.type == sf::Event::Closed)
 			mWindow.close();
+
+		// In the background, render at a low rate and keep quiet; GameState pauses itself
+		if (event.type == sf::Event::LostFocus || event.type == sf::Event::GainedFocus)
+		{
+			mHasFocus = (event.type == sf::Event::GainedFocus);
+			mSounds.setMuted(!mHasFocus);
+
+			// The window content may have been lost while covered
+			mRedrawRequested = true;
+		}
+
+		// The statistics overlay is off by default; its counters only run while it is shown
+		if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F3)
+		{
+			mRenderStatistics.setEnabled(!mRenderStatistics.isEnabled());
+			mRedrawRequested = true;
+		}
 	}
 }
 
@@ -86,28 +163,115 @@ void Application::update(sf::Time dt)
 	mStateStack.update(dt);
 }
 
-void Application::render()
+bool Application::render(float interpolation)
 {
+	// Keep the last picture on screen while no state changed
+	if (!mStateStack.isDirty() && !mRedrawRequested)
+		return false;
+
+	mStatisticsNumFrames += 1;
+	mRedrawRequested = false;
+
 	mWindow.clear();
+	mRenderStatistics.beginFrame();
 
-	mStateStack.draw();
+	mStateStack.draw(interpolation);
 
-	mWindow.setView(mWindow.getDefaultView());
-	mWindow.draw(mStatisticsText);
+	if (mRenderStatistics.isEnabled())
+	{
+		mRenderStatistics.setState(States::None);
+		CountingTarget target(mWindow, &mRenderStatistics);
+		target.setView(mWindow.getDefaultView());
+		target.draw(mStatisticsText);
+	}
 
 	mWindow.display();
+	return true;
+}
+
+void Application::updateQuality(sf::Time frameTime)
+{
+	// Only frames that were drawn count; skipped ones would make the load look lighter than it is
+	mProfiler.record("Frame", frameTime, 1);
+
+	// Unlimited render rate: aim for 60 Hz
+	sf::Time budget = mSettings.getTimePerRender();
+	budget = (budget != sf::Time::Zero) ? budget : sf::seconds(1.f / 60.f);
+	mQualityGovernor.setBudget(budget);
+
+	// Drawing-related knobs are read by the game state each frame
+	if (mQualityGovernor.addFrameTime(frameTime))
+		mSounds.setMaxVoices(mQualityGovernor.getMaxVoices());
+
+	// The frame time includes display(), so the fill cost of the scene is part of it
+	mResolutionScaler.setBudget(budget);
+	mResolutionScaler.setMaxScale(mQualityGovernor.getMaxResolutionScale());
+	mResolutionScaler.addFrameTime(frameTime);
+}
+
+void Application::waitForNextFrame(sf::Time untilNextTick)
+{
+	sf::Time timePerRender = mHasFocus ? mSettings.getTimePerRender() : BackgroundTimePerRender;
+	sf::Time now = mPacingClock.getElapsedTime();
+
+	mFrameDeadline += timePerRender;
+
+	// Unlimited, or behind schedule (stall, window dragged): restart the schedule instead of rushing frames
+	if (timePerRender == sf::Time::Zero || now >= mFrameDeadline)
+	{
+		mFrameDeadline = now;
+
+		// Nothing was dirty: no picture can change before the next tick polls events and updates
+		if (untilNextTick > sf::Time::Zero)
+		{
+			sf::sleep(untilNextTick);
+			mStatisticsIdleTime += mPacingClock.getElapsedTime() - now;
+		}
+		return;
+	}
+
+	// The OS may wake us up late, so sleep until shortly before the deadline and spin for the rest
+	if (mFrameDeadline - now > SpinThreshold)
+	{
+		sf::sleep(mFrameDeadline - now - SpinThreshold);
+		mStatisticsIdleTime += mPacingClock.getElapsedTime() - now;
+	}
+
+	while (mPacingClock.getElapsedTime() < mFrameDeadline)
+		;
 }
 
 void Application::updateStatistics(sf::Time dt)
 {
 	mStatisticsUpdateTime += dt;
-	mStatisticsNumFrames += 1;
 	if (mStatisticsUpdateTime >= sf::seconds(1.0f))
 	{
-		mStatisticsText.setString("FPS: " + toString(mStatisticsNumFrames));
+		// Share of the last second the process slept instead of using the CPU
+		int idlePercent = static_cast<int>(100.f * mStatisticsIdleTime.asSeconds() / mStatisticsUpdateTime.asSeconds());
+
+		// Flushed even while hidden, so the sections don't keep adding up
+		std::string profile = mProfiler.flush();
+
+		if (mRenderStatistics.isEnabled())
+		{
+			mStatisticsText.setString("FPS: " + toString(mStatisticsNumFrames) + "\n"
+				+ "Idle: " + toString(idlePercent) + "%\n"
+				+ "Textures: " + toString(mTextureBudget.getResidentBytes() / 1024) + " KB, "
+					+ toString(mTextureBudget.getEvictionCount()) + " evicted, "
+					+ toString(mTextureBudget.getReloadCount()) + " reloads ("
+					+ toString(mTextureBudget.getReloadTime().asMilliseconds()) + " ms)\n"
+				+ "Voices: " + toString(mSounds.getActiveVoices()) + "/" + toString(mSounds.getMaxVoices()) + ", "
+					+ toString(mSounds.getStealCount()) + " stolen, "
+					+ toString(mSounds.getDropCount()) + " dropped\n"
+				+ profile
+				+ mRenderStatistics.summary());
+
+			mRedrawRequested = true;
+		}
 
 		mStatisticsUpdateTime -= sf::seconds(1.0f);
 		mStatisticsNumFrames = 0;
+		mStatisticsIdleTime = sf::Time::Zero;
 	}
 }
 
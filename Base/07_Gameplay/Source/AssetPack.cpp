@@ -0,0 +1,150 @@
+#include <Book/AssetPack.hpp>
+
+#include <SFML/Graphics/Image.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+
+namespace
+{
+	const char PackMagic[4] = { 'B', 'K', 'P', 'K' };
+	const sf::Uint32 PackVersion = 2;
+
+	// Contents start on 16-byte boundaries, as loaders may read them in larger words
+	const std::size_t Alignment = 16;
+
+	sf::Uint64 alignOffset(sf::Uint64 offset)
+	{
+		return (offset + Alignment - 1) / Alignment * Alignment;
+	}
+
+	bool readFile(const std::string& filename, std::vector<char>& content)
+	{
+		std::ifstream file(filename.c_str(), std::ios::binary);
+		if (!file)
+			return false;
+
+		content.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+		return true;
+	}
+
+	// Decoding happens here, once, instead of at every start of the game
+	bool readTexture(const std::string& filename, std::vector<char>& content)
+	{
+		sf::Image image;
+		if (!image.loadFromFile(filename))
+			return false;
+
+		AssetPack::TextureHeader header = {};
+		header.width = image.getSize().x;
+		header.height = image.getSize().y;
+
+		const char* pixels = reinterpret_cast<const char*>(image.getPixelsPtr());
+		content.assign(reinterpret_cast<const char*>(&header), reinterpret_cast<const char*>(&header) + sizeof(header));
+		content.insert(content.end(), pixels, pixels + std::size_t(header.width) * header.height * 4);
+		return true;
+	}
+}
+
+AssetPack::AssetPack(const std::string& filename)
+: mFile()
+, mEntries(nullptr)
+, mEntryCount(0)
+{
+	if (!mFile.open(filename) || mFile.getSize() < sizeof(Header))
+		return;
+
+	Header header;
+	std::memcpy(&header, mFile.getData(), sizeof(header));
+
+	if (std::memcmp(header.magic, PackMagic, sizeof(PackMagic)) != 0 || header.version != PackVersion
+		|| mFile.getSize() < sizeof(Header) + header.entryCount * sizeof(Entry))
+	{
+		mFile.close();
+		return;
+	}
+
+	// The header is 16 bytes and the mapping page-aligned, so the table can be read in place
+	mEntries = reinterpret_cast<const Entry*>(mFile.getData() + sizeof(Header));
+	mEntryCount = header.entryCount;
+}
+
+bool AssetPack::isOpen() const
+{
+	return mEntries != nullptr;
+}
+
+bool AssetPack::find(Assets::Kind kind, unsigned int id, const void*& data, std::size_t& size) const
+{
+	if (!mEntries)
+		return false;
+
+	const Entry* end = mEntries + mEntryCount;
+	const Entry* found = std::lower_bound(mEntries, end, std::make_pair(sf::Uint32(kind), sf::Uint32(id)),
+		[] (const Entry& entry, const std::pair<sf::Uint32, sf::Uint32>& key)
+	{
+		return entry.kind < key.first || (entry.kind == key.first && entry.id < key.second);
+	});
+
+	if (found == end || found->kind != sf::Uint32(kind) || found->id != id || found->offset + found->size > mFile.getSize())
+		return false;
+
+	data = mFile.getData() + found->offset;
+	size = static_cast<std::size_t>(found->size);
+	return true;
+}
+
+bool AssetPack::write(const std::string& filename, const std::vector<Source>& sources)
+{
+	std::vector<Source> sorted(sources);
+	std::sort(sorted.begin(), sorted.end(), [] (const Source& lhs, const Source& rhs)
+	{
+		return lhs.kind < rhs.kind || (lhs.kind == rhs.kind && lhs.id < rhs.id);
+	});
+
+	// Read all contents first, to know the offsets before writing the table
+	std::vector<std::vector<char>> contents;
+	std::vector<Entry> entries;
+	sf::Uint64 offset = alignOffset(sizeof(Header) + sorted.size() * sizeof(Entry));
+
+	for (std::vector<Source>::const_iterator itr = sorted.begin(); itr != sorted.end(); ++itr)
+	{
+		contents.push_back(std::vector<char>());
+		bool read = (itr->kind == Assets::Textures) ? readTexture(itr->filename, contents.back()) : readFile(itr->filename, contents.back());
+		if (!read)
+			return false;
+
+		Entry entry;
+		entry.kind = itr->kind;
+		entry.id = itr->id;
+		entry.offset = offset;
+		entry.size = contents.back().size();
+		entries.push_back(entry);
+
+		offset = alignOffset(offset + entry.size);
+	}
+
+	Header header;
+	std::memcpy(header.magic, PackMagic, sizeof(PackMagic));
+	header.version = PackVersion;
+	header.entryCount = static_cast<sf::Uint32>(entries.size());
+	header.reserved = 0;
+
+	std::ofstream pack(filename.c_str(), std::ios::binary | std::ios::trunc);
+	pack.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	if (!entries.empty())
+		pack.write(reinterpret_cast<const char*>(&entries[0]), entries.size() * sizeof(Entry));
+
+	const char padding[Alignment] = {};
+	for (std::size_t i = 0; i < entries.size(); ++i)
+	{
+		pack.write(padding, static_cast<std::streamsize>(entries[i].offset - static_cast<sf::Uint64>(pack.tellp())));
+		if (!contents[i].empty())
+			pack.write(&contents[i][0], contents[i].size());
+	}
+
+	return static_cast<bool>(pack);
+}
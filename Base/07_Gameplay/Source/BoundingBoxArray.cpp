@@ -0,0 +1,103 @@
+#include <Book/BoundingBoxArray.hpp>
+
+#ifdef BOOK_USE_SSE2
+	#include <emmintrin.h>
+#endif
+
+#include <cassert>
+
+
+BoundingBoxArray::BoundingBoxArray()
+: mCount(0)
+, mLeft()
+, mTop()
+, mRight()
+, mBottom()
+, mCategories()
+, mMasks()
+{
+}
+
+void BoundingBoxArray::resize(std::size_t count)
+{
+	// Padding boxes have no category, so they never interact
+	std::size_t padded = count + BatchSize;
+
+	mCount = count;
+	mLeft.assign(padded, 0.f);
+	mTop.assign(padded, 0.f);
+	mRight.assign(padded, 0.f);
+	mBottom.assign(padded, 0.f);
+	mCategories.assign(padded, 0u);
+	mMasks.assign(padded, 0u);
+}
+
+void BoundingBoxArray::set(std::size_t index, const sf::FloatRect& bounds, unsigned int category, unsigned int mask)
+{
+	assert(index < mCount);
+
+	mLeft[index] = bounds.left;
+	mTop[index] = bounds.top;
+	mRight[index] = bounds.left + bounds.width;
+	mBottom[index] = bounds.top + bounds.height;
+	mCategories[index] = category;
+	mMasks[index] = mask;
+}
+
+std::size_t BoundingBoxArray::size() const
+{
+	return mCount;
+}
+
+sf::FloatRect BoundingBoxArray::getRect(std::size_t index) const
+{
+	return sf::FloatRect(mLeft[index], mTop[index], mRight[index] - mLeft[index], mBottom[index] - mTop[index]);
+}
+
+unsigned int BoundingBoxArray::getCategory(std::size_t index) const
+{
+	return mCategories[index];
+}
+
+unsigned int BoundingBoxArray::getMask(std::size_t index) const
+{
+	return mMasks[index];
+}
+
+unsigned int BoundingBoxArray::overlapBatch(std::size_t index, std::size_t first) const
+{
+	assert(first < mCount);
+
+#ifdef BOOK_USE_SSE2
+	__m128 left = _mm_set1_ps(mLeft[index]);
+	__m128 top = _mm_set1_ps(mTop[index]);
+	__m128 right = _mm_set1_ps(mRight[index]);
+	__m128 bottom = _mm_set1_ps(mBottom[index]);
+
+	// Same condition as sf::FloatRect::intersects(): the boxes overlap on both axes
+	__m128 horizontal = _mm_and_ps(_mm_cmplt_ps(left, _mm_loadu_ps(&mRight[first])), _mm_cmplt_ps(_mm_loadu_ps(&mLeft[first]), right));
+	__m128 vertical = _mm_and_ps(_mm_cmplt_ps(top, _mm_loadu_ps(&mBottom[first])), _mm_cmplt_ps(_mm_loadu_ps(&mTop[first]), bottom));
+	int overlaps = _mm_movemask_ps(_mm_and_ps(horizontal, vertical));
+
+	// Layer test: this box's mask against the other boxes' categories
+	__m128i categories = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&mCategories[first]));
+	__m128i interacts = _mm_and_si128(categories, _mm_set1_epi32(static_cast<int>(mMasks[index])));
+	int ignored = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(interacts, _mm_setzero_si128())));
+
+	return static_cast<unsigned int>(overlaps & ~ignored);
+#else
+	unsigned int result = 0;
+	for (std::size_t k = 0; k < BatchSize; ++k)
+	{
+		std::size_t other = first + k;
+		if ((mMasks[index] & mCategories[other]) != 0
+			&& mLeft[index] < mRight[other] && mLeft[other] < mRight[index]
+			&& mTop[index] < mBottom[other] && mTop[other] < mBottom[index])
+		{
+			result |= 1u << k;
+		}
+	}
+
+	return result;
+#endif
+}
@@ -2,10 +2,10 @@
 #include <Book/Utility.hpp>
 #include <Book/SoundPlayer.hpp>
 #include <Book/ResourceHolder.hpp>
+#include <Book/CountingTarget.hpp>
 
 #include <SFML/Window/Event.hpp>
 #include <SFML/Graphics/RenderStates.hpp>
-#include <SFML/Graphics/RenderTarget.hpp>
 
 #include <iostream>
 namespace GUI
@@ -38,6 +38,7 @@ void Button::setText(const std::string& text)
 {
 	mText.setString(text);
 	centerOrigin(mText);
+	requestRedraw();
 }
 
 void Button::setToggle(bool flag)
@@ -65,6 +66,7 @@ void Button::setHide(bool flag)
 		color.a = 255.f;
 
 	mSprite.setColor(color);
+	requestRedraw();
 }
 
 void Button::select()
@@ -130,7 +132,7 @@ void Button::handleEvent(const sf::Event&)
 {
 }
 
-void Button::draw(sf::RenderTarget& target, sf::RenderStates states) const
+void Button::drawCounted(CountingTarget& target, sf::RenderStates states) const
 {
 	states.transform *= getTransform();
 	target.draw(mSprite, states);
@@ -0,0 +1,150 @@
+#include <Book/Collision.hpp>
+#include <Book/Category.hpp>
+#include <Book/Aircraft.hpp>
+#include <Book/Projectile.hpp>
+#include <Book/Pickup.hpp>
+
+#include <cassert>
+
+
+namespace
+{
+	const std::size_t CategoryBits = 16;
+
+	void playerHitsEnemy(Entity& first, Entity& second, CommandQueue& commands)
+	{
+		auto& player = static_cast<Aircraft&>(first);
+		auto& enemy = static_cast<Aircraft&>(second);
+
+		// Collision: Player damage = enemy's remaining HP
+		player.damage(enemy.getHitpoints());
+		enemy.destroy();
+		enemy.playLocalSound(commands, SoundEffect::Explosion1);
+	}
+
+	void playerCollectsPickup(Entity& first, Entity& second, CommandQueue& commands)
+	{
+		auto& player = static_cast<Aircraft&>(first);
+		auto& pickup = static_cast<Pickup&>(second);
+
+		// Apply pickup effect to player, destroy pickup
+		pickup.apply(player);
+		pickup.destroy();
+		player.playLocalSound(commands, SoundEffect::CollectPickup);
+	}
+
+	void projectileHitsAircraft(Entity& first, Entity& second, CommandQueue&)
+	{
+		auto& aircraft = static_cast<Aircraft&>(first);
+		auto& projectile = static_cast<Projectile&>(second);
+
+		// Apply projectile damage to aircraft, destroy projectile
+		aircraft.damage(projectile.getDamage());
+
+		if (projectile.isEnergyBall())
+			projectile.split();
+
+		projectile.destroy();
+	}
+
+	struct Rule
+	{
+		unsigned int			first;
+		unsigned int			second;
+		Collision::Response		response;
+	};
+
+	// Every interacting category pair and its response; all other pairs are never tested
+	const Rule Rules[] =
+	{
+		{ Category::PlayerAircraft,	Category::EnemyAircraft,	&playerHitsEnemy },
+		{ Category::PlayerAircraft,	Category::Pickup,			&playerCollectsPickup },
+		{ Category::EnemyAircraft,	Category::AlliedProjectile,	&projectileHitsAircraft },
+		{ Category::PlayerAircraft,	Category::EnemyProjectile,	&projectileHitsAircraft },
+	};
+
+	struct Dispatch
+	{
+		Collision::Response		response;
+		bool					swapped;
+	};
+
+	struct DispatchTable
+	{
+		unsigned int			masks[CategoryBits];
+		Dispatch				entries[CategoryBits][CategoryBits];
+	};
+
+	std::size_t bitIndex(unsigned int category)
+	{
+		// Colliders have exactly one category bit set
+		assert(category != 0 && (category & (category - 1)) == 0);
+
+		std::size_t index = 0;
+		while (category >>= 1)
+			++index;
+
+		assert(index < CategoryBits);
+		return index;
+	}
+
+	DispatchTable initializeDispatchTable()
+	{
+		DispatchTable table = {};
+
+		for (std::size_t i = 0; i < sizeof(Rules) / sizeof(Rules[0]); ++i)
+		{
+			const Rule& rule = Rules[i];
+			std::size_t first = bitIndex(rule.first);
+			std::size_t second = bitIndex(rule.second);
+
+			table.masks[first] |= rule.second;
+			table.masks[second] |= rule.first;
+
+			Dispatch forward = { rule.response, false };
+			Dispatch backward = { rule.response, true };
+			table.entries[first][second] = forward;
+			table.entries[second][first] = backward;
+		}
+
+		return table;
+	}
+
+	// Built on first use, so it never depends on the initialization order of other translation units
+	const DispatchTable& getTable()
+	{
+		static const DispatchTable table = initializeDispatchTable();
+		return table;
+	}
+}
+
+namespace Collision
+{
+
+unsigned int getMask(unsigned int category)
+{
+	if (category == Category::None)
+		return Category::None;
+
+	return getTable().masks[bitIndex(category)];
+}
+
+bool isSwept(unsigned int category)
+{
+	return (category & Category::Projectile) != 0;
+}
+
+Contact makeContact(Entity& lhs, unsigned int lhsCategory, Entity& rhs, unsigned int rhsCategory)
+{
+	const Dispatch& dispatch = getTable().entries[bitIndex(lhsCategory)][bitIndex(rhsCategory)];
+	assert(dispatch.response != nullptr);
+
+	Contact contact;
+	contact.first = dispatch.swapped ? &rhs : &lhs;
+	contact.second = dispatch.swapped ? &lhs : &rhs;
+	contact.response = dispatch.response;
+
+	return contact;
+}
+
+}
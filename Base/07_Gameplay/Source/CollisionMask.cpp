@@ -0,0 +1,131 @@
+#include <Book/CollisionMask.hpp>
+#include <Book/Utility.hpp>
+
+#include <SFML/Graphics/Image.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+
+namespace
+{
+	const sf::Uint8 AlphaThreshold = 128;
+	const int WordBits = 64;
+
+	// Reads 64 bits of a row starting at bit 'first'; bits outside the row are zero
+	sf::Uint64 readBits(const sf::Uint64* row, int wordsPerRow, int first)
+	{
+		int word = (first >= 0) ? first / WordBits : -((-first + WordBits - 1) / WordBits);
+		int shift = first - word * WordBits;
+
+		sf::Uint64 low = (word >= 0 && word < wordsPerRow) ? row[word] : 0;
+		sf::Uint64 high = (word + 1 >= 0 && word + 1 < wordsPerRow) ? row[word + 1] : 0;
+
+		if (shift == 0)
+			return low;
+		else
+			return (low >> shift) | (high << (WordBits - shift));
+	}
+
+	int roundToInt(float value)
+	{
+		return static_cast<int>(std::floor(value + 0.5f));
+	}
+}
+
+CollisionMask::CollisionMask(const sf::Image& image)
+: mShapes()
+{
+	mShapes.reserve(RotationSteps);
+	for (std::size_t i = 0; i < RotationSteps; ++i)
+		mShapes.push_back(buildShape(image, 360.f * i / RotationSteps));
+}
+
+bool CollisionMask::overlap(const CollisionMask& lhs, sf::Vector2f lhsCenter, float lhsRotation,
+	const CollisionMask& rhs, sf::Vector2f rhsCenter, float rhsRotation)
+{
+	const Shape& a = lhs.getShape(lhsRotation);
+	const Shape& b = rhs.getShape(rhsRotation);
+
+	sf::Vector2i aPosition(roundToInt(lhsCenter.x) + a.offset.x, roundToInt(lhsCenter.y) + a.offset.y);
+	sf::Vector2i bPosition(roundToInt(rhsCenter.x) + b.offset.x, roundToInt(rhsCenter.y) + b.offset.y);
+
+	int left = std::max(aPosition.x, bPosition.x);
+	int right = std::min(aPosition.x + a.width, bPosition.x + b.width);
+	int top = std::max(aPosition.y, bPosition.y);
+	int bottom = std::min(aPosition.y + a.height, bPosition.y + b.height);
+
+	if (left >= right || top >= bottom)
+		return false;
+
+	// Only the words of a covering the overlap are tested. Their bits outside the
+	// overlap land outside b's row or on its zero padding, so no extra masking is needed.
+	int firstWord = (left - aPosition.x) / WordBits;
+	int lastWord = (right - aPosition.x - 1) / WordBits;
+	int shift = aPosition.x - bPosition.x;
+
+	for (int y = top; y < bottom; ++y)
+	{
+		const sf::Uint64* aRow = &a.bits[(y - aPosition.y) * a.wordsPerRow];
+		const sf::Uint64* bRow = &b.bits[(y - bPosition.y) * b.wordsPerRow];
+
+		for (int word = firstWord; word <= lastWord; ++word)
+		{
+			if (aRow[word] & readBits(bRow, b.wordsPerRow, word * WordBits + shift))
+				return true;
+		}
+	}
+
+	return false;
+}
+
+CollisionMask::Shape CollisionMask::buildShape(const sf::Image& image, float rotation)
+{
+	sf::Vector2u size = image.getSize();
+	sf::Vector2f half(size.x / 2.f, size.y / 2.f);
+
+	float radians = toRadian(rotation);
+	float cosine = std::cos(radians);
+	float sine = std::sin(radians);
+
+	// Extent of the rotated texture around its center
+	float extentX = std::abs(cosine) * half.x + std::abs(sine) * half.y;
+	float extentY = std::abs(sine) * half.x + std::abs(cosine) * half.y;
+
+	Shape shape;
+	shape.offset = sf::Vector2i(static_cast<int>(std::floor(-extentX)), static_cast<int>(std::floor(-extentY)));
+	shape.width = static_cast<int>(std::ceil(extentX)) - shape.offset.x;
+	shape.height = static_cast<int>(std::ceil(extentY)) - shape.offset.y;
+	shape.wordsPerRow = (shape.width + WordBits - 1) / WordBits;
+	shape.bits.assign(shape.wordsPerRow * shape.height, 0);
+
+	// Sample the texture at the center of each world pixel, rotated back into texture space
+	for (int y = 0; y < shape.height; ++y)
+	{
+		for (int x = 0; x < shape.width; ++x)
+		{
+			float worldX = shape.offset.x + x + 0.5f;
+			float worldY = shape.offset.y + y + 0.5f;
+			float textureX = cosine * worldX + sine * worldY + half.x;
+			float textureY = -sine * worldX + cosine * worldY + half.y;
+
+			if (textureX < 0.f || textureY < 0.f || textureX >= size.x || textureY >= size.y)
+				continue;
+
+			if (image.getPixel(static_cast<unsigned int>(textureX), static_cast<unsigned int>(textureY)).a >= AlphaThreshold)
+				shape.bits[y * shape.wordsPerRow + x / WordBits] |= sf::Uint64(1) << (x % WordBits);
+		}
+	}
+
+	return shape;
+}
+
+const CollisionMask::Shape& CollisionMask::getShape(float rotation) const
+{
+	float angle = std::fmod(rotation, 360.f);
+	if (angle < 0.f)
+		angle += 360.f;
+
+	std::size_t step = static_cast<std::size_t>(angle / 360.f * RotationSteps + 0.5f) % RotationSteps;
+	return mShapes[step];
+}
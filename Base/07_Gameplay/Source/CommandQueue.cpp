@@ -18,3 +18,8 @@ bool CommandQueue::isEmpty() const
 {
 	return mQueue.empty();
 }
+
+SoundEventBuffer& CommandQueue::getSoundEvents()
+{
+	return mSoundEvents;
+}
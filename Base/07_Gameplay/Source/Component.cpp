@@ -1,4 +1,5 @@
 #include <Book/Component.hpp>
+#include <Book/CountingTarget.hpp>
 
 namespace GUI
 {
@@ -6,6 +7,7 @@ namespace GUI
 Component::Component()
 : mIsSelected(false)
 , mIsActive(false)
+, mParent(nullptr)
 {
 }
 
@@ -21,11 +23,13 @@ bool Component::isSelected() const
 void Component::select()
 {
 	mIsSelected = true;
+	requestRedraw();
 }
 
 void Component::deselect()
 {
 	mIsSelected = false;
+	requestRedraw();
 }
 
 bool Component::isActive() const
@@ -36,11 +40,25 @@ bool Component::isActive() const
 void Component::activate()
 {
 	mIsActive = true;
+	requestRedraw();
 }
 
 void Component::deactivate()
 {
 	mIsActive = false;
+	requestRedraw();
+}
+
+void Component::draw(sf::RenderTarget& target, sf::RenderStates states) const
+{
+	CountingTarget uncounted(target, nullptr);
+	drawCounted(uncounted, states);
+}
+
+void Component::requestRedraw()
+{
+	if (mParent)
+		mParent->requestRedraw();
 }
 
 }
\ No newline at end of file
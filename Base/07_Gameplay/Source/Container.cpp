@@ -1,9 +1,10 @@
 #include <Book/Container.hpp>
 #include <Book/Foreach.hpp>
+#include <Book/CountingTarget.hpp>
 
 #include <SFML/Window/Event.hpp>
 #include <SFML/Graphics/RenderStates.hpp>
-#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Sprite.hpp>
 
 
 namespace GUI
@@ -14,12 +15,23 @@ Container::Container()
 , mSelectedChild(-1)
 , mIsStickMove(false)
 , mStickSensitivity(0.25f)
+, mCache()
+, mCacheValid(false)
 {
 }
 
+Container::~Container()
+{
+	// Children may be shared with the owning state and outlive the container
+	FOREACH(const Component::Ptr& child, mChildren)
+		child->mParent = nullptr;
+}
+
 void Container::pack(Component::Ptr component)
 {
 	mChildren.push_back(component);
+	component->mParent = this;
+	requestRedraw();
 
 	if (!hasSelection() && component->isSelectable())
 		select(mChildren.size() - 1);
@@ -93,12 +105,33 @@ void Container::handleEvent(const sf::Event& event)
 		mIsStickMove = false;
 }
 
-void Container::draw(sf::RenderTarget& target, sf::RenderStates states) const
+void Container::drawCounted(CountingTarget& target, sf::RenderStates states) const
 {
-    states.transform *= getTransform();
+	// The children's draws are counted in the frames that redraw the cache
+	if (!mCacheValid || mCache.getSize() != target.getSize())
+	{
+		if (mCache.getSize() != target.getSize())
+			mCache.create(target.getSize().x, target.getSize().y);
 
-	FOREACH(const Component::Ptr& child, mChildren)
-		target.draw(*child, states);
+		mCache.clear(sf::Color::Transparent);
+		CountingTarget cache(mCache, target.getStatistics());
+		FOREACH(const Component::Ptr& child, mChildren)
+			cache.draw(*child);
+		mCache.display();
+
+		mCacheValid = true;
+	}
+
+	// The cache holds colors already multiplied by their alpha; blending them by alpha again would darken translucent pixels
+	states.transform *= getTransform();
+	states.blendMode = sf::BlendMode(sf::BlendMode::One, sf::BlendMode::OneMinusSrcAlpha);
+	target.draw(sf::Sprite(mCache.getTexture()), states);
+}
+
+void Container::requestRedraw()
+{
+	mCacheValid = false;
+	Component::requestRedraw();
 }
 
 bool Container::hasSelection() const
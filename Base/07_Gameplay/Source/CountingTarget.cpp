@@ -0,0 +1,74 @@
+#include <Book/CountingTarget.hpp>
+#include <Book/RenderStatistics.hpp>
+#include <Book/Component.hpp>
+
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Text.hpp>
+#include <SFML/Graphics/Shape.hpp>
+
+
+CountingTarget::CountingTarget(sf::RenderTarget& target, RenderStatistics* statistics)
+: mTarget(&target)
+, mStatistics(statistics)
+{
+}
+
+void CountingTarget::draw(const sf::Sprite& sprite, const sf::RenderStates& states)
+{
+	if (mStatistics)
+		mStatistics->recordSprite(sprite);
+
+	mTarget->draw(sprite, states);
+}
+
+void CountingTarget::draw(const sf::Text& text, const sf::RenderStates& states)
+{
+	if (mStatistics)
+		mStatistics->recordText(text);
+
+	mTarget->draw(text, states);
+}
+
+void CountingTarget::draw(const sf::Shape& shape, const sf::RenderStates& states)
+{
+	if (mStatistics)
+		mStatistics->recordShape(shape);
+
+	mTarget->draw(shape, states);
+}
+
+void CountingTarget::draw(const GUI::Component& component, const sf::RenderStates& states)
+{
+	component.drawCounted(*this, states);
+}
+
+void CountingTarget::setView(const sf::View& view)
+{
+	mTarget->setView(view);
+}
+
+const sf::View& CountingTarget::getView() const
+{
+	return mTarget->getView();
+}
+
+const sf::View& CountingTarget::getDefaultView() const
+{
+	return mTarget->getDefaultView();
+}
+
+sf::Vector2u CountingTarget::getSize() const
+{
+	return mTarget->getSize();
+}
+
+RenderStatistics* CountingTarget::getStatistics() const
+{
+	return mStatistics;
+}
+
+sf::RenderTarget& CountingTarget::getTarget() const
+{
+	return *mTarget;
+}
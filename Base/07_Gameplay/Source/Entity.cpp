@@ -1,71 +1,166 @@
 #include <Book/Entity.hpp>
+#include <Book/Systems.hpp>
+#include <Book/Collision.hpp>
 
 #include <cassert>
 
 
-Entity::Entity(int hitpoints)
-: mVelocity()
-, mHitpoints(hitpoints)
+Entity::Entity(EntityRegistry& registry, int hitpoints)
+: mRegistry(registry)
+, mID(registry.create(*this))
 {
+	mRegistry.getHitpoints()[mRegistry.indexOf(mID)].value = hitpoints;
+}
+
+Entity::~Entity()
+{
+	mRegistry.destroy(mID);
 }
 
 void Entity::setVelocity(sf::Vector2f velocity)
 {
-	mVelocity = velocity;
+	mRegistry.getVelocities()[mRegistry.indexOf(mID)].value = velocity;
 }
 
 void Entity::setVelocity(float vx, float vy)
 {
-	mVelocity.x = vx;
-	mVelocity.y = vy;
+	setVelocity(sf::Vector2f(vx, vy));
 }
 
 sf::Vector2f Entity::getVelocity() const
 {
-	return mVelocity;
+	return mRegistry.getVelocities()[mRegistry.indexOf(mID)].value;
 }
 
 void Entity::accelerate(sf::Vector2f velocity)
 {
-	mVelocity += velocity;
+	mRegistry.getVelocities()[mRegistry.indexOf(mID)].value += velocity;
 }
 
 void Entity::accelerate(float vx, float vy)
 {
-	mVelocity.x += vx;
-	mVelocity.y += vy;
+	accelerate(sf::Vector2f(vx, vy));
+}
+
+void Entity::setPosition(sf::Vector2f position)
+{
+	// Placing an entity is a teleport, there is no motion to sweep or interpolate
+	Components::Transform& transform = mRegistry.getTransforms()[mRegistry.indexOf(mID)];
+	transform.position = position;
+	transform.previousPosition = position;
+}
+
+void Entity::setPosition(float x, float y)
+{
+	setPosition(sf::Vector2f(x, y));
+}
+
+void Entity::move(sf::Vector2f offset)
+{
+	Components::Transform& transform = mRegistry.getTransforms()[mRegistry.indexOf(mID)];
+	transform.position += offset;
+}
+
+void Entity::move(float offsetX, float offsetY)
+{
+	move(sf::Vector2f(offsetX, offsetY));
+}
+
+void Entity::setRotation(float angle)
+{
+	mRegistry.getTransforms()[mRegistry.indexOf(mID)].rotation = angle;
+}
+
+sf::Vector2f Entity::getPosition() const
+{
+	return mRegistry.getTransforms()[mRegistry.indexOf(mID)].position;
+}
+
+float Entity::getRotation() const
+{
+	return mRegistry.getTransforms()[mRegistry.indexOf(mID)].rotation;
 }
 
 int Entity::getHitpoints() const
 {
-	return mHitpoints;
+	return mRegistry.getHitpoints()[mRegistry.indexOf(mID)].value;
 }
 
 void Entity::repair(int points)
 {
 	assert(points > 0);
 
-	mHitpoints += points;
+	mRegistry.getHitpoints()[mRegistry.indexOf(mID)].value += points;
 }
 
 void Entity::damage(int points)
 {
 	assert(points > 0);
 
-	mHitpoints -= points;
+	mRegistry.getHitpoints()[mRegistry.indexOf(mID)].value -= points;
 }
 
 void Entity::destroy()
 {
-	mHitpoints = 0;
+	mRegistry.getHitpoints()[mRegistry.indexOf(mID)].value = 0;
 }
 
 bool Entity::isDestroyed() const
 {
-	return mHitpoints <= 0;
+	return getHitpoints() <= 0;
 }
 
-void Entity::updateCurrent(sf::Time dt, CommandQueue&)
-{	
-	move(mVelocity * dt.asSeconds());
+sf::FloatRect Entity::getBoundingRect() const
+{
+	std::size_t index = mRegistry.indexOf(mID);
+	return Systems::computeBoundingRect(mRegistry.getTransforms()[index], mRegistry.getSprites()[index]);
+}
+
+EntityRegistry::ID Entity::getID() const
+{
+	return mID;
+}
+
+void Entity::setSprite(const sf::Sprite& sprite)
+{
+	std::size_t index = mRegistry.indexOf(mID);
+	mRegistry.getSprites()[index].sprite = sprite;
+	mRegistry.getColliders()[index].category = getCategory();
+	mRegistry.getColliders()[index].mask = Collision::getMask(getCategory());
+	mRegistry.getColliders()[index].shape = mRegistry.getCollisionMask(sprite.getTexture());
+}
+
+sf::Sprite& Entity::getSprite()
+{
+	return mRegistry.getSprites()[mRegistry.indexOf(mID)].sprite;
+}
+
+const sf::Sprite& Entity::getSprite() const
+{
+	return mRegistry.getSprites()[mRegistry.indexOf(mID)].sprite;
+}
+
+EntityRegistry& Entity::getRegistry() const
+{
+	return mRegistry;
+}
+
+sf::Transform Entity::getLocalTransform() const
+{
+	const Components::Transform& transform = mRegistry.getTransforms()[mRegistry.indexOf(mID)];
+
+	sf::Transform localTransform;
+	localTransform.translate(transform.position).rotate(transform.rotation);
+	return localTransform;
+}
+
+sf::Transform Entity::getRenderTransform() const
+{
+	// Attached nodes (texts) follow the interpolated sprite instead of the last tick's position
+	const Components::Transform& transform = mRegistry.getTransforms()[mRegistry.indexOf(mID)];
+
+	sf::Transform renderTransform;
+	renderTransform.translate(Systems::interpolatePosition(transform, mRegistry.getInterpolation()))
+		.rotate(transform.rotation);
+	return renderTransform;
 }
@@ -0,0 +1,202 @@
+#include <Book/EntityRegistry.hpp>
+#include <Book/Category.hpp>
+
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Image.hpp>
+
+#include <cassert>
+
+
+namespace
+{
+	template <typename T>
+	void swapRemove(std::vector<T>& vector, std::size_t index)
+	{
+		vector[index] = vector.back();
+		vector.pop_back();
+	}
+}
+
+EntityRegistry::EntityRegistry()
+: mTransforms()
+, mVelocities()
+, mHitpoints()
+, mSprites()
+, mColliders()
+, mFacades()
+, mOwners()
+, mIndices()
+, mFreeIDs()
+, mWeapons()
+, mMovementPatterns()
+, mInterpolation(1.f)
+, mBoundingBoxes()
+, mCollisionMasks()
+{
+}
+
+EntityRegistry::ID EntityRegistry::create(Entity& facade)
+{
+	// Reuse IDs of destroyed entities, so the index table stays small
+	ID id;
+	if (!mFreeIDs.empty())
+	{
+		id = mFreeIDs.back();
+		mFreeIDs.pop_back();
+	}
+	else
+	{
+		id = mIndices.size();
+		mIndices.push_back(NoIndex);
+	}
+
+	Components::Transform transform = { sf::Vector2f(), sf::Vector2f(), 0.f };
+	Components::Velocity velocity = { sf::Vector2f() };
+	Components::Hitpoints hitpoints = { 0 };
+	Components::Collider collider = { Category::None, Category::None, nullptr };
+
+	mIndices[id] = mTransforms.size();
+	mTransforms.push_back(transform);
+	mVelocities.push_back(velocity);
+	mHitpoints.push_back(hitpoints);
+	mSprites.push_back(Components::Sprite());
+	mColliders.push_back(collider);
+	mFacades.push_back(&facade);
+	mOwners.push_back(id);
+
+	return id;
+}
+
+void EntityRegistry::destroy(ID id)
+{
+	std::size_t index = indexOf(id);
+
+	// Fill the hole with the last entity, in all parallel arrays at once
+	swapRemove(mTransforms, index);
+	swapRemove(mVelocities, index);
+	swapRemove(mHitpoints, index);
+	swapRemove(mSprites, index);
+	swapRemove(mColliders, index);
+	swapRemove(mFacades, index);
+	swapRemove(mOwners, index);
+
+	if (index < mOwners.size())
+		mIndices[mOwners[index]] = index;
+
+	mIndices[id] = NoIndex;
+	mFreeIDs.push_back(id);
+
+	if (mWeapons.contains(id))
+		mWeapons.remove(id);
+
+	if (mMovementPatterns.contains(id))
+		mMovementPatterns.remove(id);
+}
+
+std::size_t EntityRegistry::size() const
+{
+	return mTransforms.size();
+}
+
+std::size_t EntityRegistry::indexOf(ID id) const
+{
+	assert(id < mIndices.size() && mIndices[id] != NoIndex);
+	return mIndices[id];
+}
+
+Entity& EntityRegistry::getFacade(std::size_t index) const
+{
+	return *mFacades[index];
+}
+
+std::vector<Components::Transform>& EntityRegistry::getTransforms()
+{
+	return mTransforms;
+}
+
+const std::vector<Components::Transform>& EntityRegistry::getTransforms() const
+{
+	return mTransforms;
+}
+
+std::vector<Components::Velocity>& EntityRegistry::getVelocities()
+{
+	return mVelocities;
+}
+
+const std::vector<Components::Velocity>& EntityRegistry::getVelocities() const
+{
+	return mVelocities;
+}
+
+std::vector<Components::Hitpoints>& EntityRegistry::getHitpoints()
+{
+	return mHitpoints;
+}
+
+const std::vector<Components::Hitpoints>& EntityRegistry::getHitpoints() const
+{
+	return mHitpoints;
+}
+
+std::vector<Components::Sprite>& EntityRegistry::getSprites()
+{
+	return mSprites;
+}
+
+const std::vector<Components::Sprite>& EntityRegistry::getSprites() const
+{
+	return mSprites;
+}
+
+std::vector<Components::Collider>& EntityRegistry::getColliders()
+{
+	return mColliders;
+}
+
+const std::vector<Components::Collider>& EntityRegistry::getColliders() const
+{
+	return mColliders;
+}
+
+ComponentArray<Components::Weapon>& EntityRegistry::getWeapons()
+{
+	return mWeapons;
+}
+
+ComponentArray<Components::MovementPattern>& EntityRegistry::getMovementPatterns()
+{
+	return mMovementPatterns;
+}
+
+void EntityRegistry::setInterpolation(float interpolation)
+{
+	mInterpolation = interpolation;
+}
+
+float EntityRegistry::getInterpolation() const
+{
+	return mInterpolation;
+}
+
+BoundingBoxArray& EntityRegistry::getBoundingBoxes()
+{
+	return mBoundingBoxes;
+}
+
+const BoundingBoxArray& EntityRegistry::getBoundingBoxes() const
+{
+	return mBoundingBoxes;
+}
+
+void EntityRegistry::addCollisionMask(const sf::Texture& texture)
+{
+	if (mCollisionMasks.find(&texture) == mCollisionMasks.end())
+		mCollisionMasks.insert(std::make_pair(&texture, CollisionMask(texture.copyToImage())));
+}
+
+const CollisionMask* EntityRegistry::getCollisionMask(const sf::Texture* texture) const
+{
+	auto found = mCollisionMasks.find(texture);
+	return (found != mCollisionMasks.end()) ? &found->second : nullptr;
+}
@@ -1,4 +1,5 @@
 #include <Book/GameOverState.hpp>
+#include <Book/CountingTarget.hpp>
 #include <Book/Utility.hpp>
 #include <Book/Player.hpp>
 #include <Book/ResourceHolder.hpp>
@@ -32,9 +33,9 @@ GameOverState::GameOverState(StateStack& stack, Context context)
 	mGameOverText.setPosition(0.5f * windowSize.x, 0.4f * windowSize.y);
 }
 
-void GameOverState::draw()
+void GameOverState::draw(float)
 {
-	sf::RenderWindow& window = *getContext().window;
+	CountingTarget window(*getContext().window, getContext().statistics);
 	window.setView(window.getDefaultView());
 
 	// Create dark, semitransparent background
@@ -1,39 +1,64 @@
 #include <Book/GameState.hpp>
+#include <Book/CountingTarget.hpp>
+#include <Book/ResolutionScaler.hpp>
+#include <Book/QualityGovernor.hpp>
+
+#include <SFML/Graphics/RenderWindow.hpp>
 
 
 GameState::GameState(StateStack& stack, Context context)
 : State(stack, context)
 , mPlayer(*context.player)
-, level1(*context.window, *context.fonts, *context.player, *context.sounds)
-, level2(*context.window, *context.fonts, *context.sounds)
-, level3(*context.window, *context.fonts, *context.sounds)
+, level1(*context.window, *context.fonts, *context.player, *context.sounds, *context.profiler, *context.textureBudget, *context.assets)
+, level2(*context.window, *context.fonts, *context.sounds, *context.profiler, *context.textureBudget, *context.assets)
+, level3(*context.window, *context.fonts, *context.sounds, *context.profiler, *context.textureBudget, *context.assets)
 , level(CurrentLevel::LVL_1)
+, mSceneTexture()
+, mFreezeFrame()
+, mFrozen(false)
+, mFreezeFrameCaptured(false)
 {
 	level1.initialize();
 	mPlayer.setMissionStatus(Player::MissionRunning);
+	setOpaque(true);
 	
 	// Play game theme
 	
 }
 
-void GameState::draw()
+void GameState::draw(float interpolation)
 {
-	switch(level)
+	CountingTarget window(*getContext().window, getContext().statistics);
+
+	if (!mFrozen)
 	{
-	case 0:
-		level1.draw();
-		break;
-	case 1:
-		level2.draw();
-		break;
-	case 2:
-		level3.draw();
-		break;
+		drawScene(window, interpolation);
+		return;
 	}
+
+	// The scene can't change under an overlay: render it once, then draw a single quad
+	if (!mFreezeFrameCaptured)
+	{
+		if (mFreezeFrame.getSize() != window.getSize())
+			mFreezeFrame.create(window.getSize().x, window.getSize().y);
+
+		mFreezeFrame.clear();
+		CountingTarget freezeFrame(mFreezeFrame, getContext().statistics);
+		drawLevel(freezeFrame, interpolation);
+		mFreezeFrame.display();
+		mFreezeFrameCaptured = true;
+	}
+
+	window.setView(window.getDefaultView());
+	window.draw(sf::Sprite(mFreezeFrame.getTexture()));
 }
 
 bool GameState::update(sf::Time dt)
 {
+	// Updated again, so no overlay is left on top
+	mFrozen = false;
+	mFreezeFrameCaptured = false;
+
 	{
 		switch(level)
 		{
@@ -42,12 +67,12 @@ bool GameState::update(sf::Time dt)
 			if(!level1.hasAlivePlayer())
 			{
 				mPlayer.setMissionStatus(Player::MissionFailure);
-				requestStackPush(States::GameOver);
+				pushOverlay(States::GameOver);
 			}
 			else if(level1.hasPlayerReachedEnd())
 			{
 				mPlayer.setMissionStatus(Player::MissionSuccess);
-				requestStackPush(States::GameOver);
+				pushOverlay(States::GameOver);
 				level = CurrentLevel::LVL_2;
 				level1.clearLevel();
 				level2.initialize();
@@ -60,12 +85,12 @@ bool GameState::update(sf::Time dt)
 			if(!level2.hasAlivePlayer())
 			{
 				mPlayer.setMissionStatus(Player::MissionFailure);
-				requestStackPush(States::GameOver);
+				pushOverlay(States::GameOver);
 			}
 			else if(level2.hasPlayerReachedEnd())
 			{
 				mPlayer.setMissionStatus(Player::MissionSuccess);
-				requestStackPush(States::GameOver);
+				pushOverlay(States::GameOver);
 				level = CurrentLevel::LVL_3;
 				level2.clearLevel();
 				level3.initialize();
@@ -78,12 +103,12 @@ bool GameState::update(sf::Time dt)
 			if(!level3.hasAlivePlayer())
 			{
 				mPlayer.setMissionStatus(Player::MissionFailure);
-				requestStackPush(States::GameOver);
+				pushOverlay(States::GameOver);
 			}
 			else if(level3.hasPlayerReachedEnd())
 			{
 				mPlayer.setMissionStatus(Player::MissionWin);
-				requestStackPush(States::GameOver);
+				pushOverlay(States::GameOver);
 			}
 			mPlayer.handleRealtimeInput(level3.getCommandQueue());
 			break;
@@ -109,9 +134,65 @@ bool GameState::handleEvent(const sf::Event& event)
 		break;
 	}
 
-	// Escape pressed, trigger the pause screen
-	if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::Escape)
-		requestStackPush(States::Pause);
+	// Escape pressed or window left, trigger the pause screen
+	if ((event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::Escape)
+		|| event.type == sf::Event::LostFocus)
+		pushOverlay(States::Pause);
 
 	return true;
-}
\ No newline at end of file
+}
+
+void GameState::drawScene(CountingTarget& target, float interpolation)
+{
+	// Application feeds the scaler the whole frame time, display() included
+	float scale = getContext().resolution->getScale();
+
+	if (scale >= 1.f)
+	{
+		drawLevel(target, interpolation);
+		return;
+	}
+
+	// Fill rate is what costs: render the scene into fewer pixels, then stretch it over the target.
+	// The level's view covers the same world area whatever the texture size.
+	sf::Vector2u size = target.getSize();
+	sf::Vector2u sceneSize(static_cast<unsigned int>(size.x * scale), static_cast<unsigned int>(size.y * scale));
+	if (mSceneTexture.getSize() != sceneSize)
+	{
+		mSceneTexture.create(sceneSize.x, sceneSize.y);
+		mSceneTexture.setSmooth(true);
+	}
+
+	mSceneTexture.clear();
+	CountingTarget scene(mSceneTexture, target.getStatistics());
+	drawLevel(scene, interpolation);
+	mSceneTexture.display();
+
+	sf::Sprite sprite(mSceneTexture.getTexture());
+	sprite.setScale(static_cast<float>(size.x) / sceneSize.x, static_cast<float>(size.y) / sceneSize.y);
+	target.setView(target.getDefaultView());
+	target.draw(sprite);
+}
+
+void GameState::drawLevel(CountingTarget& target, float interpolation)
+{
+	switch(level)
+	{
+	case 0:
+		level1.draw(target, *getContext().quality, interpolation);
+		break;
+	case 1:
+		level2.draw(target, *getContext().quality, interpolation);
+		break;
+	case 2:
+		level3.draw(target, *getContext().quality, interpolation);
+		break;
+	}
+}
+
+void GameState::pushOverlay(States::ID stateID)
+{
+	// Overlays stop updating the states below, so the scene stays as it is until popped
+	mFrozen = true;
+	requestStackPush(stateID);
+}
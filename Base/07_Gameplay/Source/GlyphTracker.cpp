@@ -0,0 +1,98 @@
+#include <Book/GlyphTracker.hpp>
+
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Text.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+
+namespace
+{
+	// Statistics overlay, labels and buttons, scene texts, title, pause and game over texts
+	const unsigned int CharacterSizes[] = { 10, 16, 20, 30, 70 };
+
+	const sf::Uint32 FirstCharacter = ' ';
+	const sf::Uint32 LastCharacter = '~';
+}
+
+GlyphTracker::GlyphTracker()
+: mRasterized()
+, mPages()
+{
+}
+
+void GlyphTracker::prewarm(const sf::Font& font)
+{
+	for (std::size_t i = 0; i < sizeof(CharacterSizes) / sizeof(CharacterSizes[0]); ++i)
+	{
+		for (sf::Uint32 character = FirstCharacter; character <= LastCharacter; ++character)
+		{
+			font.getGlyph(character, CharacterSizes[i], false);
+			insert(font, CharacterSizes[i], character, false);
+		}
+
+		// Only sizes that have a page can be checked; asking for another size would create one
+		Page page;
+		page.font = &font;
+		page.characterSize = CharacterSizes[i];
+		page.textureSize = font.getTexture(CharacterSizes[i]).getSize();
+		mPages.push_back(page);
+	}
+}
+
+std::size_t GlyphTracker::track(const sf::Text& text)
+{
+	const sf::Font* font = text.getFont();
+	if (!font)
+		return 0;
+
+	const sf::String& string = text.getString();
+	unsigned int characterSize = text.getCharacterSize();
+	bool bold = (text.getStyle() & sf::Text::Bold) != 0;
+
+	// The layout asks for the space glyph for its advance, whatever the string
+	std::size_t rasterized = (string.getSize() > 0 && insert(*font, characterSize, ' ', bold)) ? 1 : 0;
+
+	for (std::size_t i = 0; i < string.getSize(); ++i)
+	{
+		// Whitespace is layout only
+		sf::Uint32 character = string[i];
+		if (character == ' ' || character == '\t' || character == '\n')
+			continue;
+
+		if (insert(*font, characterSize, character, bold))
+			++rasterized;
+	}
+
+	return rasterized;
+}
+
+std::size_t GlyphTracker::countGrownPages() const
+{
+	std::size_t grown = 0;
+	for (std::size_t i = 0; i < mPages.size(); ++i)
+	{
+		const Page& page = mPages[i];
+		if (page.font->getTexture(page.characterSize).getSize() != page.textureSize)
+			++grown;
+	}
+
+	return grown;
+}
+
+bool GlyphTracker::insert(const sf::Font& font, unsigned int characterSize, sf::Uint32 character, bool bold)
+{
+	Glyph glyph = { &font, characterSize, character, bold };
+	return mRasterized.insert(glyph).second;
+}
+
+bool GlyphTracker::Glyph::operator< (const Glyph& other) const
+{
+	if (font != other.font)
+		return font < other.font;
+	if (characterSize != other.characterSize)
+		return characterSize < other.characterSize;
+	if (character != other.character)
+		return character < other.character;
+
+	return bold < other.bold;
+}
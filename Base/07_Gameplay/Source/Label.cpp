@@ -1,8 +1,8 @@
 #include <Book/Label.hpp>
 #include <Book/Utility.hpp>
+#include <Book/CountingTarget.hpp>
 
 #include <SFML/Graphics/RenderStates.hpp>
-#include <SFML/Graphics/RenderTarget.hpp>
 
 
 namespace GUI
@@ -22,7 +22,7 @@ void Label::handleEvent(const sf::Event&)
 {
 }
 
-void Label::draw(sf::RenderTarget& target, sf::RenderStates states) const
+void Label::drawCounted(CountingTarget& target, sf::RenderStates states) const
 {
 	states.transform *= getTransform();
 	target.draw(mText, states);
@@ -31,6 +31,7 @@ void Label::draw(sf::RenderTarget& target, sf::RenderStates states) const
 void Label::setText(const std::string& text)
 {
 	mText.setString(text);
+	requestRedraw();
 }
 
 bool Label::checkWorldBounds()
@@ -3,7 +3,7 @@
 #include <Book/Pickup.hpp>
 #include <Book/Foreach.hpp>
 #include <Book/TextNode.hpp>
-#include <Book/SoundNode.hpp>
+#include <Book/Systems.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
 
 #include <algorithm>
@@ -11,37 +11,53 @@
 #include <limits>
 
 
-Level2::Level2(sf::RenderWindow& window, FontHolder& fonts, SoundPlayer& sounds)
+Level2::Level2(sf::RenderWindow& window, FontHolder& fonts, SoundPlayer& sounds, Profiler& profiler, ResourceBudget& textureBudget, const AssetPack& assets)
 : mWindow(window)
 , mWorldView(window.getDefaultView())
+, mTextures()
 , mFonts(fonts)
 , mSounds(sounds)
-, mTextures() 
+, mProfiler(profiler)
+, mRegistry()
 , mSceneGraph()
 , mSceneLayers()
 , mWorldBounds(0.f, 0.f, mWorldView.getSize().x, 2000.f)
 , mSpawnPosition(mWorldView.getSize().x / 2.f, mWorldBounds.height - mWorldView.getSize().y / 2.f)
 , mScrollSpeed(-50.f)
+, mPreviousViewCenter()
+, mTexturesLoaded(false)
 , mPlayerAircraft(nullptr)
 , mEnemySpawnPoints()
 , mActiveEnemies()
 , enemyCount(20)
 , difficulty(2)
 {
-	loadTextures();
+	// Textures are loaded when the level first starts; while it isn't played they may be
+	// evicted, and are reloaded when it starts again
+	mTextures.setBudget(textureBudget);
+	mTextures.setPack(assets);
 	
 	// Prepare the view
 	mWorldView.setCenter(mSpawnPosition);
+	mPreviousViewCenter = mSpawnPosition;
 }
 
 void Level2::initialize()
 {
+	if (!mTexturesLoaded)
+	{
+		loadTextures();
+		mTexturesLoaded = true;
+	}
+
+	mTextures.setPinned(true);
 	buildScene();
 }
 
 void Level2::update(sf::Time dt)
 {
 	// Scroll the world, reset player velocity
+	mPreviousViewCenter = mWorldView.getCenter();
 	mWorldView.move(0.f, mScrollSpeed * dt.asSeconds());	
 	mPlayerAircraft->setVelocity(0.f, 0.f);
 
@@ -61,17 +77,34 @@ void Level2::update(sf::Time dt)
 	mSceneGraph.removeWrecks();
 	spawnEnemies();
 
-	// Regular update step, adapt position (correct if outside view)
+	// Regular update step, move entities, adapt position (correct if outside view)
 	mSceneGraph.update(dt, mCommandQueue);
+	Systems::updateMovementPatterns(mRegistry, dt);
+	Systems::integrateVelocities(mRegistry, dt);
 	adaptPlayerPosition();
 	
-	updateSounds();
+	updateSounds(dt);
 }
 
-void Level2::draw()
+void Level2::draw(CountingTarget& target, const QualityGovernor& quality, float interpolation)
 {
-	mWindow.setView(mWorldView);
-	mWindow.draw(mSceneGraph);
+	// The simulation may tick slower than the display refreshes: draw between the last two ticks
+	sf::View view = mWorldView;
+	view.setCenter(mPreviousViewCenter + (mWorldView.getCenter() - mPreviousViewCenter) * interpolation);
+	target.setView(view);
+	mRegistry.setInterpolation(interpolation);
+
+	// Skip nodes and sprites outside the view, give or take the margin of the quality level
+	float margin = quality.getCullMargin();
+	sf::FloatRect viewBounds(view.getCenter() - view.getSize() / 2.f - sf::Vector2f(margin, margin),
+		view.getSize() + sf::Vector2f(2.f * margin, 2.f * margin));
+	mRenderQueue.setLayerEnabled(RenderQueue::Details, quality.drawsDetails());
+	mProfiler.count("Culled nodes", mSceneGraph.cull(viewBounds));
+
+	// Background, entity sprites from the registry and attached texts, drawn sorted by layer and texture
+	mSceneGraph.enqueue(mRenderQueue, sf::RenderStates::Default);
+	mProfiler.count("Culled sprites", Systems::enqueueSprites(mRegistry, mRenderQueue, viewBounds));
+	mProfiler.count("Texture changes avoided", mRenderQueue.flush(target));
 }
 
 CommandQueue& Level2::getCommandQueue()
@@ -95,26 +128,41 @@ void Level2::clearLevel()
 		mSceneLayers[Air]->pop();
 
 	mSceneLayers[Background]->pop();
+
+	mTextures.setPinned(false);
 }
 
 void Level2::loadTextures()
 {
-	mTextures.load(Textures::Eagle, "Media/Textures/Eagle.png");
-	mTextures.load(Textures::Raptor, "Media/Textures/Raptor.png");
-	mTextures.load(Textures::Avenger, "Media/Textures/Avenger.png");
-	mTextures.load(Textures::Desert, "Media/Textures/Desert.png");
-	mTextures.load(Textures::Sea, "Media/Textures/sea-texture.jpg");
-	mTextures.load(Textures::Grass, "Media/Textures/grass-texture.jpg");
-
-	mTextures.load(Textures::Bullet, "Media/Textures/Bullet.png");
-	mTextures.load(Textures::Missile, "Media/Textures/Missile.png");
-	mTextures.load(Textures::EnergyBall, "Media/Textures/EnergyBall.png");
-
-	mTextures.load(Textures::HealthRefill, "Media/Textures/HealthRefill.png");
-	mTextures.load(Textures::MissileRefill, "Media/Textures/MissileRefill.png");
-	mTextures.load(Textures::EnergyRefill, "Media/Textures/EnergyRefill.png");
-	mTextures.load(Textures::FireSpread, "Media/Textures/FireSpread.png");
-	mTextures.load(Textures::FireRate, "Media/Textures/FireRate.png");
+	// Decoded in parallel, uploaded in order on this thread
+	TextureHolder::FileList files;
+	files.push_back(std::make_pair(Textures::Eagle, "Media/Textures/Eagle.png"));
+	files.push_back(std::make_pair(Textures::Raptor, "Media/Textures/Raptor.png"));
+	files.push_back(std::make_pair(Textures::Avenger, "Media/Textures/Avenger.png"));
+	files.push_back(std::make_pair(Textures::Desert, "Media/Textures/Desert.png"));
+	files.push_back(std::make_pair(Textures::Sea, "Media/Textures/sea-texture.jpg"));
+	files.push_back(std::make_pair(Textures::Grass, "Media/Textures/grass-texture.jpg"));
+
+	files.push_back(std::make_pair(Textures::Bullet, "Media/Textures/Bullet.png"));
+	files.push_back(std::make_pair(Textures::Missile, "Media/Textures/Missile.png"));
+	files.push_back(std::make_pair(Textures::EnergyBall, "Media/Textures/EnergyBall.png"));
+
+	files.push_back(std::make_pair(Textures::HealthRefill, "Media/Textures/HealthRefill.png"));
+	files.push_back(std::make_pair(Textures::MissileRefill, "Media/Textures/MissileRefill.png"));
+	files.push_back(std::make_pair(Textures::EnergyRefill, "Media/Textures/EnergyRefill.png"));
+	files.push_back(std::make_pair(Textures::FireSpread, "Media/Textures/FireSpread.png"));
+	files.push_back(std::make_pair(Textures::FireRate, "Media/Textures/FireRate.png"));
+
+	mTextures.loadAll(files);
+	mTextures.checkLoaded(Textures::Eagle, Textures::FireRate);
+
+	// Pixel masks for the narrow phase, built once from the alpha channel
+	mRegistry.addCollisionMask(mTextures.get(Textures::Eagle));
+	mRegistry.addCollisionMask(mTextures.get(Textures::Raptor));
+	mRegistry.addCollisionMask(mTextures.get(Textures::Avenger));
+	mRegistry.addCollisionMask(mTextures.get(Textures::Bullet));
+	mRegistry.addCollisionMask(mTextures.get(Textures::Missile));
+	mRegistry.addCollisionMask(mTextures.get(Textures::EnergyBall));
 }
 
 void Level2::adaptPlayerPosition()
@@ -128,7 +176,9 @@ void Level2::adaptPlayerPosition()
 	position.x = std::min(position.x, viewBounds.left + viewBounds.width - borderDistance);
 	position.y = std::max(position.y, viewBounds.top + borderDistance);
 	position.y = std::min(position.y, viewBounds.top + viewBounds.height - borderDistance);
-	mPlayerAircraft->setPosition(position);
+
+	// Move rather than place the aircraft, so its previous position stays valid
+	mPlayerAircraft->move(position - mPlayerAircraft->getPosition());
 }
 
 void Level2::adaptPlayerVelocity(float deltaTime)
@@ -157,76 +207,28 @@ void Level2::adaptPlayerVelocity(float deltaTime)
 	mPlayerAircraft->accelerate(0.f, mScrollSpeed);
 }
 
-bool Level2::matchesCategories(SceneNode::Pair& colliders, Category::Type type1, Category::Type type2)
-{
-	unsigned int category1 = colliders.first->getCategory();
-	unsigned int category2 = colliders.second->getCategory();
-
-	// Make sure first pair entry has category type1 and second has type2
-	if (type1 & category1 && type2 & category2)
-	{
-		return true;
-	}
-	else if (type1 & category2 && type2 & category1)
-	{
-		std::swap(colliders.first, colliders.second);
-		return true;
-	}
-	else
-	{
-		return false;
-	}
-}
-
 void Level2::handleCollisions()
 {
-	std::set<SceneNode::Pair> collisionPairs;
-	mSceneGraph.checkSceneCollision(mSceneGraph, collisionPairs);
-
-	FOREACH(SceneNode::Pair pair, collisionPairs)
-	{
-		if (matchesCategories(pair, Category::PlayerAircraft, Category::EnemyAircraft))
-		{
-			auto& player = static_cast<Aircraft&>(*pair.first);
-			auto& enemy = static_cast<Aircraft&>(*pair.second);
-
-			// Collision: Player damage = enemy's remaining HP
-			player.damage(enemy.getHitpoints());
-			enemy.destroy();
-			
-			enemy.playLocalSound(mCommandQueue, SoundEffect::Explosion1);
-		}
-
-		else if (matchesCategories(pair, Category::PlayerAircraft, Category::Pickup))
-		{
-			auto& player = static_cast<Aircraft&>(*pair.first);
-			auto& pickup = static_cast<Pickup&>(*pair.second);
-
-			// Apply pickup effect to player, destroy projectile
-			pickup.apply(player);
-			pickup.destroy();
-			
-			player.playLocalSound(mCommandQueue, SoundEffect::CollectPickup);
-		}
-
-		else if (matchesCategories(pair, Category::EnemyAircraft, Category::AlliedProjectile)
-			  || matchesCategories(pair, Category::PlayerAircraft, Category::EnemyProjectile))
-		{
-			auto& aircraft = static_cast<Aircraft&>(*pair.first);
-			auto& projectile = static_cast<Projectile&>(*pair.second);
+	// Refresh the collider bounds once, then test all interacting pairs on the packed array
+	std::vector<Collision::Contact> contacts;
+	Systems::updateColliders(mRegistry);
+	Systems::findCollisions(mRegistry, contacts, mProfiler);
 
-			// Apply projectile damage to aircraft, destroy projectile
-			aircraft.damage(projectile.getDamage());
-			projectile.destroy();
-		}
-	}
+	FOREACH(const Collision::Contact& contact, contacts)
+		contact.response(*contact.first, *contact.second, mCommandQueue);
 }
 
-void Level2::updateSounds()
+void Level2::updateSounds(sf::Time dt)
 {
 	// Set listener's position to player position
 	mSounds.setListenerPosition(mPlayerAircraft->getWorldPosition());
 
+	// Play this tick's effects, skipping inaudible and duplicate ones
+	SoundEventBuffer& events = mCommandQueue.getSoundEvents();
+	events.flush(mSounds, getViewBounds(), dt);
+	mProfiler.count("Sounds culled", events.getCulledCount());
+	mProfiler.count("Sounds merged", events.getMergedCount());
+
 	// Remove unused sounds
 	mSounds.removeStoppedSounds();
 }
@@ -254,12 +256,8 @@ void Level2::buildScene()
 	backgroundSprite->setPosition(mWorldBounds.left, mWorldBounds.top);
 	mSceneLayers[Background]->attachChild(std::move(backgroundSprite));
 
-	// Add sound effect node
-	std::unique_ptr<SoundNode> soundNode(new SoundNode(mSounds));
-	mSceneGraph.attachChild(std::move(soundNode));
-	
 	// Add player's aircraft
-	std::unique_ptr<Aircraft> player(new Aircraft(Aircraft::Eagle, mTextures, mFonts, mWindow, 0));
+	std::unique_ptr<Aircraft> player(new Aircraft(Aircraft::Eagle, mTextures, mFonts, mRegistry, 0));
 	mPlayerAircraft = player.get();
 	mPlayerAircraft->setPosition(mSpawnPosition);
 	mSceneLayers[Air]->attachChild(std::move(player));
@@ -312,7 +310,7 @@ void Level2::spawnEnemies()
 	{
 		SpawnPoint spawn = mEnemySpawnPoints.back();
 		
-		std::unique_ptr<Aircraft> enemy(new Aircraft(spawn.type, mTextures, mFonts, mWindow, difficulty));
+		std::unique_ptr<Aircraft> enemy(new Aircraft(spawn.type, mTextures, mFonts, mRegistry, difficulty));
 		enemy->setPosition(spawn.x, spawn.y);
 		enemy->setRotation(180.f);
 
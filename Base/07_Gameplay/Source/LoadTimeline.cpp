@@ -0,0 +1,56 @@
+#include <Book/LoadTimeline.hpp>
+
+#include <SFML/System/Lock.hpp>
+
+#include <fstream>
+
+
+LoadTimeline::LoadTimeline()
+: mClock()
+, mSteps()
+, mMutex()
+{
+}
+
+sf::Time LoadTimeline::now() const
+{
+	sf::Lock lock(mMutex);
+	return mClock.getElapsedTime();
+}
+
+void LoadTimeline::record(const std::string& asset, const std::string& phase, unsigned int thread, sf::Time start)
+{
+	sf::Lock lock(mMutex);
+
+	Step step;
+	step.asset = asset;
+	step.phase = phase;
+	step.thread = thread;
+	step.start = start;
+	step.end = mClock.getElapsedTime();
+	mSteps.push_back(step);
+}
+
+bool LoadTimeline::writeToFile(const std::string& filename) const
+{
+	sf::Lock lock(mMutex);
+
+	std::ofstream file(filename.c_str());
+	if (!file)
+		return false;
+
+	// Thread 0 is the main thread, workers are numbered from 1
+	sf::Time total = sf::Time::Zero;
+	file << "asset,phase,thread,start_us,duration_us\n";
+	for (std::vector<Step>::const_iterator itr = mSteps.begin(); itr != mSteps.end(); ++itr)
+	{
+		file << itr->asset << ',' << itr->phase << ',' << itr->thread << ','
+			<< itr->start.asMicroseconds() << ',' << (itr->end - itr->start).asMicroseconds() << '\n';
+
+		if (itr->end > total)
+			total = itr->end;
+	}
+
+	file << "total,,," << 0 << ',' << total.asMicroseconds() << '\n';
+	return true;
+}
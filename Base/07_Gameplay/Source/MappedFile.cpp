@@ -0,0 +1,94 @@
+#include <Book/MappedFile.hpp>
+
+#include <fstream>
+
+#if defined(__unix__) || defined(__APPLE__)
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <fcntl.h>
+	#include <unistd.h>
+	#define BOOK_USE_MMAP
+#endif
+
+
+MappedFile::MappedFile()
+: mData(nullptr)
+, mSize(0)
+, mMapped(false)
+, mBuffer()
+{
+}
+
+MappedFile::~MappedFile()
+{
+	close();
+}
+
+bool MappedFile::open(const std::string& filename)
+{
+	close();
+
+#ifdef BOOK_USE_MMAP
+	int descriptor = ::open(filename.c_str(), O_RDONLY);
+	if (descriptor < 0)
+		return false;
+
+	struct stat status;
+	if (fstat(descriptor, &status) != 0 || status.st_size == 0)
+	{
+		::close(descriptor);
+		return false;
+	}
+
+	// The mapping stays valid after the descriptor is closed
+	void* data = mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE, descriptor, 0);
+	::close(descriptor);
+	if (data == MAP_FAILED)
+		return false;
+
+	mData = static_cast<const sf::Uint8*>(data);
+	mSize = static_cast<std::size_t>(status.st_size);
+	mMapped = true;
+	return true;
+#else
+	std::ifstream file(filename.c_str(), std::ios::binary);
+	if (!file)
+		return false;
+
+	file.seekg(0, std::ios::end);
+	mBuffer.resize(static_cast<std::size_t>(file.tellg()));
+	file.seekg(0, std::ios::beg);
+	if (mBuffer.empty() || !file.read(reinterpret_cast<char*>(&mBuffer[0]), mBuffer.size()))
+	{
+		mBuffer.clear();
+		return false;
+	}
+
+	mData = &mBuffer[0];
+	mSize = mBuffer.size();
+	return true;
+#endif
+}
+
+void MappedFile::close()
+{
+#ifdef BOOK_USE_MMAP
+	if (mMapped)
+		munmap(const_cast<sf::Uint8*>(mData), mSize);
+#endif
+
+	mData = nullptr;
+	mSize = 0;
+	mMapped = false;
+	mBuffer.clear();
+}
+
+const sf::Uint8* MappedFile::getData() const
+{
+	return mData;
+}
+
+std::size_t MappedFile::getSize() const
+{
+	return mSize;
+}
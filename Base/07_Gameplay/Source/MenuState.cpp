@@ -1,4 +1,5 @@
 #include <Book/MenuState.hpp>
+#include <Book/CountingTarget.hpp>
 #include <Book/Button.hpp>
 #include <Book/Utility.hpp>
 #include <Book/MusicPlayer.hpp>
@@ -45,11 +46,14 @@ MenuState::MenuState(StateStack& stack, Context context)
 	
 	// Play menu theme
 	context.music->play(Music::MenuTheme);
+
+	enableDrawOnDemand();
+	setOpaque(true);
 }
 
-void MenuState::draw()
+void MenuState::draw(float)
 {
-	sf::RenderWindow& window = *getContext().window;
+	CountingTarget window(*getContext().window, getContext().statistics);
 
 	window.setView(window.getDefaultView());
 
@@ -64,6 +68,9 @@ bool MenuState::update(sf::Time)
 
 bool MenuState::handleEvent(const sf::Event& event)
 {
+	// Any event may change the selected or pressed button
 	mGUIContainer.handleEvent(event);
+	invalidate();
+
 	return false;
 }
@@ -1,8 +1,9 @@
 #include <Book/MusicPlayer.hpp>
 
 
-MusicPlayer::MusicPlayer()
+MusicPlayer::MusicPlayer(const AssetPack& pack)
 : mMusic()
+, mPack(pack)
 , mFilenames()
 , mVolume(100.f)
 {
@@ -14,7 +15,14 @@ void MusicPlayer::play(Music::ID theme)
 {
 	std::string filename = mFilenames[theme];
 
-	if (!mMusic.openFromFile(filename))
+	// Streamed straight from the mapped pack if the theme is in there
+	const void* data;
+	std::size_t size;
+	bool opened = mPack.find(Assets::Music, theme, data, size)
+		? mMusic.openFromMemory(data, size)
+		: mMusic.openFromFile(filename);
+
+	if (!opened)
 		throw std::runtime_error("Music " + filename + " could not be loaded.");
 
 	mMusic.setVolume(mVolume);
@@ -0,0 +1,81 @@
+// Bakes the loose files of Media/ into a single asset pack.
+// Usage: PackBaker <media directory> <output pack>
+
+#include <Book/AssetPack.hpp>
+#include <Book/ResourceIdentifiers.hpp>
+
+#include <iostream>
+
+
+namespace
+{
+	struct ManifestEntry
+	{
+		Assets::Kind	kind;
+		unsigned int	id;
+		const char*		path;
+	};
+
+	// IDs come straight from ResourceIdentifiers.hpp, so the table can't drift from the enums
+	const ManifestEntry Manifest[] =
+	{
+		{ Assets::Textures,	Textures::Eagle,			"Textures/Eagle.png" },
+		{ Assets::Textures,	Textures::Raptor,			"Textures/Raptor.png" },
+		{ Assets::Textures,	Textures::Avenger,			"Textures/Avenger.png" },
+		{ Assets::Textures,	Textures::Bullet,			"Textures/Bullet.png" },
+		{ Assets::Textures,	Textures::Missile,			"Textures/Missile.png" },
+		{ Assets::Textures,	Textures::EnergyBall,		"Textures/EnergyBall.png" },
+		{ Assets::Textures,	Textures::Desert,			"Textures/Desert.png" },
+		{ Assets::Textures,	Textures::Sea,				"Textures/sea-texture.jpg" },
+		{ Assets::Textures,	Textures::Grass,			"Textures/grass-texture.jpg" },
+		{ Assets::Textures,	Textures::HealthRefill,		"Textures/HealthRefill.png" },
+		{ Assets::Textures,	Textures::MissileRefill,	"Textures/MissileRefill.png" },
+		{ Assets::Textures,	Textures::EnergyRefill,		"Textures/EnergyRefill.png" },
+		{ Assets::Textures,	Textures::FireSpread,		"Textures/FireSpread.png" },
+		{ Assets::Textures,	Textures::FireRate,			"Textures/FireRate.png" },
+		{ Assets::Textures,	Textures::TitleScreen,		"Textures/TitleScreen.png" },
+		{ Assets::Textures,	Textures::ButtonNormal,		"Textures/ButtonNormal.png" },
+		{ Assets::Textures,	Textures::ButtonSelected,	"Textures/ButtonSelected.png" },
+		{ Assets::Textures,	Textures::ButtonPressed,	"Textures/ButtonPressed.png" },
+
+		{ Assets::Fonts,	Fonts::Main,				"Sansation.ttf" },
+
+		{ Assets::Sounds,	SoundEffect::AlliedGunfire,	"Sound/AlliedGunfire.wav" },
+		{ Assets::Sounds,	SoundEffect::EnemyGunfire,	"Sound/EnemyGunfire.wav" },
+		{ Assets::Sounds,	SoundEffect::Explosion1,	"Sound/Explosion1.wav" },
+		{ Assets::Sounds,	SoundEffect::Explosion2,	"Sound/Explosion2.wav" },
+		{ Assets::Sounds,	SoundEffect::LaunchMissile,	"Sound/LaunchMissile.wav" },
+		{ Assets::Sounds,	SoundEffect::CollectPickup,	"Sound/CollectPickup.wav" },
+		{ Assets::Sounds,	SoundEffect::Button,		"Sound/Button.wav" },
+
+		{ Assets::Music,	Music::MenuTheme,			"Music/MenuTheme.ogg" },
+		{ Assets::Music,	Music::MissionTheme,		"Music/MissionTheme.ogg" },
+	};
+}
+
+int main(int argc, char* argv[])
+{
+	if (argc != 3)
+	{
+		std::cout << "Usage: " << argv[0] << " <media directory> <output pack>" << std::endl;
+		return 1;
+	}
+
+	std::vector<AssetPack::Source> sources;
+	for (std::size_t i = 0; i < sizeof(Manifest) / sizeof(Manifest[0]); ++i)
+	{
+		AssetPack::Source source;
+		source.kind = Manifest[i].kind;
+		source.id = Manifest[i].id;
+		source.filename = std::string(argv[1]) + "/" + Manifest[i].path;
+		sources.push_back(source);
+	}
+
+	if (!AssetPack::write(argv[2], sources))
+	{
+		std::cout << "Failed to bake " << argv[2] << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
@@ -1,4 +1,5 @@
 #include <Book/PauseState.hpp>
+#include <Book/CountingTarget.hpp>
 #include <Book/Button.hpp>
 #include <Book/Utility.hpp>
 #include <Book/MusicPlayer.hpp>
@@ -52,9 +53,9 @@ PauseState::~PauseState()
 	getContext().music->setPaused(false);
 }
 
-void PauseState::draw()
+void PauseState::draw(float)
 {
-	sf::RenderWindow& window = *getContext().window;
+	CountingTarget window(*getContext().window, getContext().statistics);
 	window.setView(window.getDefaultView());
 
 	sf::RectangleShape backgroundShape;
@@ -5,20 +5,18 @@
 #include <Book/Utility.hpp>
 #include <Book/ResourceHolder.hpp>
 
-#include <SFML/Graphics/RenderTarget.hpp>
-
 
 namespace
 {
 	const std::vector<PickupData> Table = initializePickupData();
 }
 
-Pickup::Pickup(Type type, const TextureHolder& textures)
-: Entity(1)
+Pickup::Pickup(Type type, const TextureHolder& textures, EntityRegistry& registry)
+: Entity(registry, 1)
 , mType(type)
-, mSprite(textures.get(Table[type].texture))
 {
-	centerOrigin(mSprite);
+	setSprite(sf::Sprite(textures.get(Table[type].texture)));
+	centerOrigin(getSprite());
 }
 
 unsigned int Pickup::getCategory() const
@@ -26,18 +24,8 @@ unsigned int Pickup::getCategory() const
 	return Category::Pickup;
 }
 
-sf::FloatRect Pickup::getBoundingRect() const
-{
-	return getWorldTransform().transformRect(mSprite.getGlobalBounds());
-}
-
 void Pickup::apply(Aircraft& player) const
 {
 	Table[mType].action(player);
 }
 
-void Pickup::drawCurrent(sf::RenderTarget& target, sf::RenderStates states) const
-{
-	target.draw(mSprite, states);
-}
-
@@ -72,7 +72,17 @@ void Player::handleEvent(const sf::Event& event, CommandQueue& commands)
 	if (event.type == sf::Event::MouseButtonPressed && isMouse())
 	{
 		auto found = mMouseBinding.find(event.mouseButton.button);
-		if (found != mMouseBinding.end() && isRealtimeAction(found->second))
+		if (found != mMouseBinding.end() && found->second == SeekTarget)
+		{
+			// Seek the clicked point; the position comes with the event, so the aircraft needs no window
+			sf::Vector2i target(event.mouseButton.x, event.mouseButton.y);
+
+			Command seek;
+			seek.category = Category::PlayerAircraft;
+			seek.action = derivedAction<Aircraft>([target] (Aircraft& a, sf::Time) { a.setSeek(target); });
+			commands.push(seek);
+		}
+		else if (found != mMouseBinding.end() && isRealtimeAction(found->second))
 		{
 			commands.push(mActionBinding[found->second]);
 		}
@@ -207,7 +217,6 @@ void Player::initializeActions()
 	mActionBinding[MoveRight].action = derivedAction<Aircraft>(AircraftMover(+1, 0));
 	mActionBinding[MoveUp].action = derivedAction<Aircraft>(AircraftMover(0, -1));
 	mActionBinding[MoveDown].action = derivedAction<Aircraft>(AircraftMover(0, +1));
-	mActionBinding[SeekTarget].action = derivedAction<Aircraft>([](Aircraft& a, sf::Time) { a.setSeek(); });
 	mActionBinding[StopSeek].action = derivedAction<Aircraft>([](Aircraft& a, sf::Time) { a.stopSeek(); });
 	mActionBinding[Fire].action = derivedAction<Aircraft>([](Aircraft& a, sf::Time) { a.fire(); });
 	mActionBinding[LaunchMissile].action = derivedAction<Aircraft>([](Aircraft& a, sf::Time) { a.launchMissile(); });
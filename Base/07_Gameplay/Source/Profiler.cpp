@@ -0,0 +1,58 @@
+#include <Book/Profiler.hpp>
+#include <Book/Utility.hpp>
+
+
+Profiler::Stopwatch::Stopwatch()
+: mStart(std::chrono::steady_clock::now())
+{
+}
+
+sf::Int64 Profiler::Stopwatch::getElapsedNanoseconds() const
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - mStart).count();
+}
+
+Profiler::Profiler()
+: mSections()
+{
+}
+
+void Profiler::record(const std::string& section, sf::Time time, std::size_t count)
+{
+	recordNanoseconds(section, time.asMicroseconds() * 1000, count);
+}
+
+void Profiler::recordNanoseconds(const std::string& section, sf::Int64 nanoseconds, std::size_t count)
+{
+	Section& entry = mSections[section];
+	entry.nanoseconds += nanoseconds;
+	entry.count += count;
+	entry.timed = true;
+}
+
+void Profiler::count(const std::string& counter, std::size_t count)
+{
+	mSections[counter].count += count;
+}
+
+std::string Profiler::flush()
+{
+	std::string result;
+
+	for (std::map<std::string, Section>::const_iterator itr = mSections.begin(); itr != mSections.end(); ++itr)
+	{
+		const Section& entry = itr->second;
+		if (!entry.timed)
+		{
+			result += itr->first + ": " + toString(entry.count) + "\n";
+			continue;
+		}
+
+		sf::Int64 nanosecondsPerItem = (entry.count > 0) ? entry.nanoseconds / static_cast<sf::Int64>(entry.count) : 0;
+
+		result += itr->first + ": " + toString(entry.count) + " x " + toString(nanosecondsPerItem) + "ns\n";
+	}
+
+	mSections.clear();
+	return result;
+}
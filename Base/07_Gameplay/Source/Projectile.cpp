@@ -3,9 +3,6 @@
 #include <Book/Utility.hpp>
 #include <Book/ResourceHolder.hpp>
 
-#include <SFML/Graphics/RenderTarget.hpp>
-#include <SFML/Graphics/RenderStates.hpp>
-
 #include <cmath>
 #include <cassert>
 
@@ -15,13 +12,13 @@ namespace
 	const std::vector<ProjectileData> Table = initializeProjectileData();
 }
 
-Projectile::Projectile(Type type, const TextureHolder& textures)
-: Entity(1)
+Projectile::Projectile(Type type, const TextureHolder& textures, EntityRegistry& registry)
+: Entity(registry, 1)
 , mType(type)
-, mSprite(textures.get(Table[type].texture))
 , mTargetDirection()
 {
-	centerOrigin(mSprite);
+	setSprite(sf::Sprite(textures.get(Table[type].texture)));
+	centerOrigin(getSprite());
 }
 
 void Projectile::guideTowards(sf::Vector2f position)
@@ -44,7 +41,7 @@ void Projectile::split()
 	printf("Split \n");
 }
 
-void Projectile::updateCurrent(sf::Time dt, CommandQueue& commands)
+void Projectile::updateCurrent(sf::Time dt, CommandQueue&)
 {
 	if (isGuided())
 	{
@@ -57,13 +54,6 @@ void Projectile::updateCurrent(sf::Time dt, CommandQueue& commands)
 		setRotation(toDegree(angle) + 90.f);
 		setVelocity(newVelocity);
 	}
-
-	Entity::updateCurrent(dt, commands);
-}
-
-void Projectile::drawCurrent(sf::RenderTarget& target, sf::RenderStates states) const
-{
-	target.draw(mSprite, states);
 }
 
 unsigned int Projectile::getCategory() const
@@ -74,11 +64,6 @@ unsigned int Projectile::getCategory() const
 		return Category::AlliedProjectile;
 }
 
-sf::FloatRect Projectile::getBoundingRect() const
-{
-	return getWorldTransform().transformRect(mSprite.getGlobalBounds());
-}
-
 float Projectile::getMaxSpeed() const
 {
 	return Table[mType].speed;
@@ -0,0 +1,110 @@
+#include <Book/QualityGovernor.hpp>
+#include <Book/Utility.hpp>
+
+#include <iostream>
+
+
+namespace
+{
+	struct LevelData
+	{
+		const char*			name;
+		std::size_t			maxVoices;
+		bool				drawsDetails;
+		float				cullMargin;
+		float				maxResolutionScale;
+	};
+
+	// Indexed by QualityGovernor::Level
+	const LevelData Table[] =
+	{
+		{ "Low",	8,	false,	0.f,	0.6f },
+		{ "Medium",	16,	true,	32.f,	0.8f },
+		{ "High",	32,	true,	64.f,	1.f },
+	};
+
+	static_assert(sizeof(Table) / sizeof(Table[0]) == QualityGovernor::LevelCount, "Table must have one entry per QualityGovernor::Level");
+
+	const std::size_t WindowFrames = 30;
+
+	// Raise the level only after this many windows below the headroom ratio of the budget
+	const std::size_t CalmWindowsToRaise = 3;
+	const float HeadroomRatio = 0.6f;
+}
+
+QualityGovernor::QualityGovernor()
+: mBudget(sf::seconds(1.f / 60.f))
+, mAccumulatedTime()
+, mSamples(0)
+, mCalmWindows(0)
+, mLevel(High)
+{
+}
+
+void QualityGovernor::setBudget(sf::Time budget)
+{
+	mBudget = budget;
+}
+
+bool QualityGovernor::addFrameTime(sf::Time time)
+{
+	mAccumulatedTime += time;
+	if (++mSamples < WindowFrames)
+		return false;
+
+	sf::Time average = mAccumulatedTime / static_cast<sf::Int64>(mSamples);
+	mAccumulatedTime = sf::Time::Zero;
+	mSamples = 0;
+
+	Level previous = mLevel;
+	if (average > mBudget)
+	{
+		mCalmWindows = 0;
+		if (mLevel > Low)
+			mLevel = static_cast<Level>(mLevel - 1);
+	}
+	else if (average < mBudget * HeadroomRatio)
+	{
+		if (++mCalmWindows >= CalmWindowsToRaise && mLevel < High)
+		{
+			mLevel = static_cast<Level>(mLevel + 1);
+			mCalmWindows = 0;
+		}
+	}
+	else
+	{
+		mCalmWindows = 0;
+	}
+
+	if (mLevel == previous)
+		return false;
+
+	std::cout << "Quality: " << Table[previous].name << " -> " << Table[mLevel].name
+		<< " (frame " << toString(average.asMicroseconds()) << "us, budget " << toString(mBudget.asMicroseconds()) << "us)" << std::endl;
+	return true;
+}
+
+QualityGovernor::Level QualityGovernor::getLevel() const
+{
+	return mLevel;
+}
+
+std::size_t QualityGovernor::getMaxVoices() const
+{
+	return Table[mLevel].maxVoices;
+}
+
+bool QualityGovernor::drawsDetails() const
+{
+	return Table[mLevel].drawsDetails;
+}
+
+float QualityGovernor::getCullMargin() const
+{
+	return Table[mLevel].cullMargin;
+}
+
+float QualityGovernor::getMaxResolutionScale() const
+{
+	return Table[mLevel].maxResolutionScale;
+}
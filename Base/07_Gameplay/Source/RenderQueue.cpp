@@ -0,0 +1,155 @@
+#include <Book/RenderQueue.hpp>
+#include <Book/CountingTarget.hpp>
+#include <Book/RenderStatistics.hpp>
+
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Text.hpp>
+
+#include <algorithm>
+#include <cassert>
+
+
+namespace
+{
+	const unsigned int LayerShift = 56;
+	const unsigned int DepthShift = 32;
+	const sf::Uint32 MaxDepth = (1u << 24) - 1;
+	const sf::Uint32 MaxTextureID = 0xFFFFFFFFu;
+
+	// Radix sort digit: 8 bits per pass, 8 passes over the full key
+	const unsigned int RadixBits = 8;
+	const std::size_t RadixSize = 1 << RadixBits;
+}
+
+RenderQueue::RenderQueue()
+: mItems()
+, mScratch()
+, mTextures()
+{
+	std::fill(mLayerEnabled, mLayerEnabled + LayerCount, true);
+}
+
+void RenderQueue::setLayerEnabled(Layer layer, bool enabled)
+{
+	mLayerEnabled[layer] = enabled;
+}
+
+void RenderQueue::submit(const sf::Sprite& sprite, const sf::RenderStates& states,
+	Layer layer, const sf::Texture* texture, sf::Uint32 depth)
+{
+	push(sprite, false, states, layer, texture, depth);
+}
+
+void RenderQueue::submit(const sf::Text& text, const sf::RenderStates& states,
+	Layer layer, const sf::Texture* texture, sf::Uint32 depth)
+{
+	push(text, true, states, layer, texture, depth);
+}
+
+void RenderQueue::push(const sf::Drawable& drawable, bool isText, const sf::RenderStates& states,
+	Layer layer, const sf::Texture* texture, sf::Uint32 depth)
+{
+	if (!mLayerEnabled[layer])
+		return;
+
+	assert(depth <= MaxDepth);
+
+	Item item;
+	item.key = (sf::Uint64(layer) << LayerShift) | (sf::Uint64(depth) << DepthShift) | getTextureID(texture);
+	item.drawable = &drawable;
+	item.isText = isText;
+	item.states = states;
+
+	mItems.push_back(item);
+}
+
+std::size_t RenderQueue::flush(CountingTarget& target)
+{
+	std::size_t unsortedChanges = countTextureChanges(mItems);
+	sort();
+
+	// Items are sorted by layer, so each layer is entered once
+	RenderStatistics* statistics = target.getStatistics();
+	sf::Uint64 layer = sf::Uint64(-1);
+	for (std::vector<Item>::const_iterator itr = mItems.begin(); itr != mItems.end(); ++itr)
+	{
+		if (statistics && itr->key >> LayerShift != layer)
+		{
+			layer = itr->key >> LayerShift;
+			statistics->setLayer(static_cast<std::size_t>(layer));
+		}
+
+		if (itr->isText)
+			target.draw(static_cast<const sf::Text&>(*itr->drawable), itr->states);
+		else
+			target.draw(static_cast<const sf::Sprite&>(*itr->drawable), itr->states);
+	}
+
+	if (statistics)
+		statistics->setLayer(RenderStatistics::NoLayer);
+
+	std::size_t saved = unsortedChanges - countTextureChanges(mItems);
+	mItems.clear();
+
+	return saved;
+}
+
+sf::Uint32 RenderQueue::getTextureID(const sf::Texture* texture)
+{
+	// 0 is reserved for untextured drawables; the few textures of a level make a linear search cheap
+	if (!texture)
+		return 0;
+
+	std::vector<const sf::Texture*>::iterator found = std::find(mTextures.begin(), mTextures.end(), texture);
+	if (found != mTextures.end())
+		return static_cast<sf::Uint32>(found - mTextures.begin()) + 1;
+
+	mTextures.push_back(texture);
+
+	return static_cast<sf::Uint32>(mTextures.size());
+}
+
+void RenderQueue::sort()
+{
+	// Least significant digit first radix sort; each pass is stable, so equal keys keep their order
+	mScratch.resize(mItems.size());
+
+	for (unsigned int shift = 0; shift < 64; shift += RadixBits)
+	{
+		std::size_t offsets[RadixSize] = {};
+		for (std::vector<Item>::const_iterator itr = mItems.begin(); itr != mItems.end(); ++itr)
+			++offsets[(itr->key >> shift) & (RadixSize - 1)];
+
+		// All keys share this digit (e.g. unused texture or depth bits): the pass wouldn't change anything
+		if (std::find(offsets, offsets + RadixSize, mItems.size()) != offsets + RadixSize)
+			continue;
+
+		std::size_t total = 0;
+		for (std::size_t digit = 0; digit < RadixSize; ++digit)
+		{
+			std::size_t count = offsets[digit];
+			offsets[digit] = total;
+			total += count;
+		}
+
+		for (std::vector<Item>::const_iterator itr = mItems.begin(); itr != mItems.end(); ++itr)
+			mScratch[offsets[(itr->key >> shift) & (RadixSize - 1)]++] = *itr;
+
+		mItems.swap(mScratch);
+	}
+}
+
+std::size_t RenderQueue::countTextureChanges(const std::vector<Item>& items)
+{
+	std::size_t changes = 0;
+	for (std::size_t i = 1; i < items.size(); ++i)
+	{
+		sf::Uint32 previous = static_cast<sf::Uint32>(items[i - 1].key & MaxTextureID);
+		sf::Uint32 current = static_cast<sf::Uint32>(items[i].key & MaxTextureID);
+
+		if (previous != current)
+			++changes;
+	}
+
+	return changes;
+}
@@ -0,0 +1,177 @@
+#include <Book/RenderStatistics.hpp>
+#include <Book/Utility.hpp>
+
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Text.hpp>
+#include <SFML/Graphics/Shape.hpp>
+
+#include <algorithm>
+
+
+namespace
+{
+	// Indexed by States::ID; nothing is drawn in state None, so its scope holds the overlay
+	const char* StateNames[] = { "Statistics", "Title", "Menu", "Game", "Loading", "Pause", "Settings", "GameOver" };
+	static_assert(sizeof(StateNames) / sizeof(StateNames[0]) == States::Count, "StateNames must have one entry per States::ID");
+
+	// Indexed by RenderQueue::Layer
+	const char* LayerNames[] = { "Background", "Entities", "Overlay", "Details" };
+	static_assert(sizeof(LayerNames) / sizeof(LayerNames[0]) == RenderQueue::LayerCount, "LayerNames must have one entry per RenderQueue::Layer");
+
+	// Glyphs are drawn as quads; whitespace produces no geometry
+	std::size_t countGlyphVertices(const sf::String& string)
+	{
+		std::size_t vertices = 0;
+		for (std::size_t i = 0; i < string.getSize(); ++i)
+		{
+			if (string[i] != ' ' && string[i] != '\t' && string[i] != '\n')
+				vertices += 4;
+		}
+
+		return vertices;
+	}
+
+	std::string formatCounts(const RenderStatistics::Counts& counts)
+	{
+		return toString(counts.drawCalls) + " draws, "
+			+ toString(counts.vertices) + " verts, "
+			+ toString(counts.textureSwitches) + " tex, "
+			+ toString(counts.textDraws) + " texts";
+	}
+}
+
+RenderStatistics::Counts::Counts()
+: drawCalls(0)
+, vertices(0)
+, textureSwitches(0)
+, textDraws(0)
+{
+}
+
+RenderStatistics::RenderStatistics()
+: mTotal()
+, mScopes()
+, mScope(nullptr)
+, mState(States::None)
+, mLastTexture(nullptr)
+, mLastPage(0)
+, mGlyphs()
+, mRasterizedGlyphs(0)
+, mEnabled(false)
+{
+	mScope = &mScopes[mState][NoLayer];
+}
+
+void RenderStatistics::beginFrame()
+{
+	mTotal = Counts();
+	for (std::size_t state = 0; state < States::Count; ++state)
+		std::fill(mScopes[state], mScopes[state] + NoLayer + 1, Counts());
+
+	mLastTexture = nullptr;
+	mLastPage = 0;
+}
+
+void RenderStatistics::setEnabled(bool enabled)
+{
+	mEnabled = enabled;
+}
+
+bool RenderStatistics::isEnabled() const
+{
+	return mEnabled;
+}
+
+void RenderStatistics::setState(States::ID state)
+{
+	mState = state;
+	mScope = &mScopes[state][NoLayer];
+}
+
+void RenderStatistics::setLayer(std::size_t layer)
+{
+	mScope = &mScopes[mState][layer];
+}
+
+void RenderStatistics::recordSprite(const sf::Sprite& sprite)
+{
+	if (mEnabled)
+		record(4, sprite.getTexture(), 0, false);
+}
+
+void RenderStatistics::recordText(const sf::Text& text)
+{
+	if (!mEnabled)
+		return;
+
+	// The glyph page of a font depends on the character size
+	record(countGlyphVertices(text.getString()), text.getFont(), text.getCharacterSize(), true);
+	mRasterizedGlyphs += mGlyphs.track(text);
+}
+
+void RenderStatistics::recordShape(const sf::Shape& shape)
+{
+	// Triangle fan: center, the points and the first point again to close it
+	if (mEnabled)
+		record(shape.getPointCount() + 2, shape.getTexture(), 0, false);
+}
+
+const RenderStatistics::Counts& RenderStatistics::getFrameTotal() const
+{
+	return mTotal;
+}
+
+std::size_t RenderStatistics::getRasterizedGlyphs() const
+{
+	return mRasterizedGlyphs;
+}
+
+GlyphTracker& RenderStatistics::getGlyphs()
+{
+	return mGlyphs;
+}
+
+const RenderStatistics::Counts& RenderStatistics::getFrameCounts(States::ID state, std::size_t layer) const
+{
+	return mScopes[state][layer];
+}
+
+std::string RenderStatistics::summary() const
+{
+	std::string result = "Frame: " + formatCounts(mTotal) + "\n"
+		+ "Glyphs rasterized: " + toString(mRasterizedGlyphs) + ", pages grown: " + toString(mGlyphs.countGrownPages()) + "\n";
+
+	for (std::size_t state = 0; state < States::Count; ++state)
+	{
+		for (std::size_t layer = 0; layer <= NoLayer; ++layer)
+		{
+			const Counts& counts = mScopes[state][layer];
+			if (counts.drawCalls == 0)
+				continue;
+
+			std::string scope = (layer == NoLayer) ? StateNames[state] : std::string(StateNames[state]) + "/" + LayerNames[layer];
+			result += "  " + scope + ": " + formatCounts(counts) + "\n";
+		}
+	}
+
+	return result;
+}
+
+void RenderStatistics::record(std::size_t vertices, const void* texture, unsigned int page, bool isText)
+{
+	bool textureSwitch = texture && (texture != mLastTexture || page != mLastPage);
+	if (texture)
+	{
+		mLastTexture = texture;
+		mLastPage = page;
+	}
+
+	Counts* counts[] = { &mTotal, mScope };
+	for (std::size_t i = 0; i < 2; ++i)
+	{
+		counts[i]->drawCalls += 1;
+		counts[i]->vertices += vertices;
+		counts[i]->textureSwitches += textureSwitch ? 1 : 0;
+		counts[i]->textDraws += isText ? 1 : 0;
+	}
+}
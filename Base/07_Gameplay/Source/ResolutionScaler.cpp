@@ -0,0 +1,58 @@
+#include <Book/ResolutionScaler.hpp>
+
+#include <algorithm>
+
+
+namespace
+{
+	const float MinScale = 0.5f;
+	const float MaxScale = 1.f;
+	const float ScaleStep = 0.1f;
+
+	// Frames averaged before each decision, so single slow frames don't cause flicker
+	const std::size_t SampleFrames = 15;
+
+	// Scale up only below this share of the budget; the gap avoids toggling between two steps
+	const float HeadroomRatio = 0.7f;
+}
+
+ResolutionScaler::ResolutionScaler()
+: mBudget(sf::seconds(1.f / 60.f))
+, mAccumulatedTime()
+, mSamples(0)
+, mScale(MaxScale)
+, mMaxScale(MaxScale)
+{
+}
+
+void ResolutionScaler::setBudget(sf::Time budget)
+{
+	mBudget = budget;
+}
+
+void ResolutionScaler::setMaxScale(float maxScale)
+{
+	mMaxScale = std::max(MinScale, std::min(MaxScale, maxScale));
+	mScale = std::min(mScale, mMaxScale);
+}
+
+void ResolutionScaler::addFrameTime(sf::Time time)
+{
+	mAccumulatedTime += time;
+	if (++mSamples < SampleFrames)
+		return;
+
+	sf::Time average = mAccumulatedTime / static_cast<sf::Int64>(mSamples);
+	if (average > mBudget)
+		mScale = std::max(MinScale, mScale - ScaleStep);
+	else if (average < mBudget * HeadroomRatio)
+		mScale = std::min(mMaxScale, mScale + ScaleStep);
+
+	mAccumulatedTime = sf::Time::Zero;
+	mSamples = 0;
+}
+
+float ResolutionScaler::getScale() const
+{
+	return mScale;
+}
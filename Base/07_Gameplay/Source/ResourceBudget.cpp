@@ -0,0 +1,150 @@
+#include <Book/ResourceBudget.hpp>
+
+#include <SFML/Graphics/Texture.hpp>
+
+#include <cassert>
+
+
+std::size_t getResourceBytes(const sf::Texture& texture)
+{
+	// RGBA, 8 bits per channel
+	return static_cast<std::size_t>(texture.getSize().x) * texture.getSize().y * 4;
+}
+
+ResourceSettings<sf::Texture>::ResourceSettings()
+: smooth(false)
+, repeated(false)
+{
+}
+
+void ResourceSettings<sf::Texture>::save(const sf::Texture& texture)
+{
+	smooth = texture.isSmooth();
+	repeated = texture.isRepeated();
+}
+
+void ResourceSettings<sf::Texture>::apply(sf::Texture& texture) const
+{
+	texture.setSmooth(smooth);
+	texture.setRepeated(repeated);
+}
+
+ResourceBudget::ResourceBudget(std::size_t maxBytes)
+: mEntries()
+, mFreeHandles()
+, mMaxBytes(maxBytes)
+, mResidentBytes(0)
+, mUseCounter(0)
+, mEnforceNeeded(false)
+, mEvictionCount(0)
+, mReloadCount(0)
+, mReloadTime()
+{
+}
+
+ResourceBudget::Handle ResourceBudget::add(std::size_t bytes, std::function<void()> evict)
+{
+	Entry entry;
+	entry.bytes = bytes;
+	entry.lastUse = ++mUseCounter;
+	entry.pinned = false;
+	entry.resident = true;
+	entry.evict = std::move(evict);
+
+	mResidentBytes += bytes;
+	mEnforceNeeded = true;
+
+	if (mFreeHandles.empty())
+	{
+		mEntries.push_back(std::move(entry));
+		return mEntries.size() - 1;
+	}
+
+	Handle handle = mFreeHandles.back();
+	mFreeHandles.pop_back();
+	mEntries[handle] = std::move(entry);
+	return handle;
+}
+
+void ResourceBudget::remove(Handle handle)
+{
+	Entry& entry = mEntries[handle];
+	if (entry.resident)
+		mResidentBytes -= entry.bytes;
+
+	entry = Entry();
+	entry.resident = false;
+	mFreeHandles.push_back(handle);
+}
+
+void ResourceBudget::touch(Handle handle)
+{
+	mEntries[handle].lastUse = ++mUseCounter;
+}
+
+void ResourceBudget::setPinned(Handle handle, bool pinned)
+{
+	mEntries[handle].pinned = pinned;
+	mEnforceNeeded = mEnforceNeeded || !pinned;
+}
+
+void ResourceBudget::markReloaded(Handle handle, std::size_t bytes, sf::Time stall)
+{
+	Entry& entry = mEntries[handle];
+	assert(!entry.resident);
+
+	entry.bytes = bytes;
+	entry.resident = true;
+	mResidentBytes += bytes;
+	mEnforceNeeded = true;
+
+	mReloadCount += 1;
+	mReloadTime += stall;
+}
+
+void ResourceBudget::enforce()
+{
+	// Eviction only frees what went over the budget; until more comes in or gets evictable, nothing changes
+	if (!mEnforceNeeded)
+		return;
+
+	mEnforceNeeded = false;
+	while (mResidentBytes > mMaxBytes)
+	{
+		// Few resources are loaded at a time, so a linear search for the oldest one is enough
+		Entry* victim = nullptr;
+		for (std::vector<Entry>::iterator itr = mEntries.begin(); itr != mEntries.end(); ++itr)
+		{
+			if (itr->resident && !itr->pinned && itr->evict && (!victim || itr->lastUse < victim->lastUse))
+				victim = &*itr;
+		}
+
+		if (!victim)
+			return;
+
+		victim->evict();
+		victim->resident = false;
+		mResidentBytes -= victim->bytes;
+		mEvictionCount += 1;
+	}
+}
+
+std::size_t ResourceBudget::getResidentBytes() const
+{
+	return mResidentBytes;
+}
+
+std::size_t ResourceBudget::getEvictionCount() const
+{
+	return mEvictionCount;
+}
+
+std::size_t ResourceBudget::getReloadCount() const
+{
+	return mReloadCount;
+}
+
+sf::Time ResourceBudget::getReloadTime() const
+{
+	return mReloadTime;
+}
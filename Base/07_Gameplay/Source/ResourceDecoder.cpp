@@ -0,0 +1,67 @@
+#include <Book/ResourceDecoder.hpp>
+#include <Book/AssetPack.hpp>
+
+#include <cstring>
+
+
+ResourceDecoder<sf::Texture>::Decoded::Decoded()
+: image()
+, pixels(nullptr)
+, size()
+{
+}
+
+bool ResourceDecoder<sf::Texture>::decode(Decoded& decoded, const std::string& filename)
+{
+	return decoded.image.loadFromFile(filename);
+}
+
+bool ResourceDecoder<sf::Texture>::decodeMemory(Decoded& decoded, const void* data, std::size_t size)
+{
+	// Pack contents: header and pixels, decoded by the baker
+	AssetPack::TextureHeader header;
+	if (size < sizeof(header))
+		return false;
+
+	std::memcpy(&header, data, sizeof(header));
+	if (size != sizeof(header) + std::size_t(header.width) * header.height * 4)
+		return false;
+
+	decoded.pixels = static_cast<const sf::Uint8*>(data) + sizeof(header);
+	decoded.size = sf::Vector2u(header.width, header.height);
+	return true;
+}
+
+std::unique_ptr<sf::Texture> ResourceDecoder<sf::Texture>::finish(Decoded& decoded)
+{
+	std::unique_ptr<sf::Texture> texture(new sf::Texture());
+	if (!upload(decoded, *texture))
+		return nullptr;
+
+	return texture;
+}
+
+bool ResourceDecoder<sf::Texture>::load(sf::Texture& texture, const std::string& filename)
+{
+	Decoded decoded;
+	return decode(decoded, filename) && upload(decoded, texture);
+}
+
+bool ResourceDecoder<sf::Texture>::loadMemory(sf::Texture& texture, const void* data, std::size_t size)
+{
+	Decoded decoded;
+	return decodeMemory(decoded, data, size) && upload(decoded, texture);
+}
+
+bool ResourceDecoder<sf::Texture>::upload(Decoded& decoded, sf::Texture& texture)
+{
+	if (!decoded.pixels)
+		return texture.loadFromImage(decoded.image);
+
+	// Pixels go from the mapped file straight to the texture, without an sf::Image copy
+	if (!texture.create(decoded.size.x, decoded.size.y))
+		return false;
+
+	texture.update(decoded.pixels);
+	return true;
+}
@@ -11,10 +11,25 @@
 #include <cmath>
 
 
+namespace
+{
+	bool isSameTransform(const sf::Transform& lhs, const sf::Transform& rhs)
+	{
+		return std::equal(lhs.getMatrix(), lhs.getMatrix() + 16, rhs.getMatrix());
+	}
+}
+
 SceneNode::SceneNode(Category::Type category)
 : mChildren()
 , mParent(nullptr)
 , mDefaultCategory(category)
+, mRenderTransform()
+, mWorldTransform()
+, mDrawBounds()
+, mCullBounds()
+, mBoundsDirty(true)
+, mBoundsChanged(false)
+, mCulled(false)
 {
 }
 
@@ -31,7 +46,9 @@ sf::Vector2f SceneNode::normalize(sf::Vector2f source)
 void SceneNode::attachChild(Ptr child)
 {
 	child->mParent = this;
+	child->mBoundsDirty = true;
 	mChildren.push_back(std::move(child));
+	mBoundsDirty = true;
 }
 
 SceneNode::Ptr SceneNode::detachChild(const SceneNode& node)
@@ -42,6 +59,7 @@ SceneNode::Ptr SceneNode::detachChild(const SceneNode& node)
 	Ptr result = std::move(*found);
 	result->mParent = nullptr;
 	mChildren.erase(found);
+	mBoundsDirty = true;
 	return result;
 }
 
@@ -71,8 +89,12 @@ void SceneNode::updateChildren(sf::Time dt, CommandQueue& commands)
 
 void SceneNode::draw(sf::RenderTarget& target, sf::RenderStates states) const
 {
+	// Nothing of this subtree reaches into the view
+	if (mCulled)
+		return;
+
 	// Apply transform of current node
-	states.transform *= getTransform();
+	states.transform *= getRenderTransform();
 
 	// Draw node and children with changed transform
 	drawCurrent(target, states);
@@ -87,6 +109,88 @@ void SceneNode::drawCurrent(sf::RenderTarget&, sf::RenderStates) const
 	// Do nothing by default
 }
 
+void SceneNode::enqueue(RenderQueue& queue, sf::RenderStates states) const
+{
+	if (mCulled)
+		return;
+
+	states.transform *= getRenderTransform();
+
+	enqueueCurrent(queue, states);
+	FOREACH(const Ptr& child, mChildren)
+		child->enqueue(queue, states);
+}
+
+void SceneNode::enqueueCurrent(RenderQueue&, sf::RenderStates) const
+{
+	// Do nothing by default
+}
+
+sf::FloatRect SceneNode::getDrawBounds() const
+{
+	return sf::FloatRect();
+}
+
+sf::Transform SceneNode::getLocalTransform() const
+{
+	return getTransform();
+}
+
+sf::Transform SceneNode::getRenderTransform() const
+{
+	return getLocalTransform();
+}
+
+void SceneNode::invalidateBounds()
+{
+	mBoundsDirty = true;
+}
+
+std::size_t SceneNode::cull(const sf::FloatRect& area)
+{
+	return cull(area, sf::Transform::Identity, false);
+}
+
+std::size_t SceneNode::cull(const sf::FloatRect& area, const sf::Transform& parentTransform, bool parentMoved)
+{
+	// World transforms change top-down, bounds bottom-up; only changed parts are recomputed
+	sf::Transform renderTransform = getRenderTransform();
+	bool moved = parentMoved || mBoundsDirty || !isSameTransform(renderTransform, mRenderTransform);
+	bool changed = moved;
+
+	if (moved)
+	{
+		mRenderTransform = renderTransform;
+		mWorldTransform = parentTransform * renderTransform;
+
+		sf::FloatRect drawBounds = getDrawBounds();
+		mDrawBounds = (drawBounds.width > 0.f && drawBounds.height > 0.f) ? mWorldTransform.transformRect(drawBounds) : sf::FloatRect();
+		mBoundsDirty = false;
+	}
+
+	std::size_t culled = 0;
+	FOREACH(Ptr& child, mChildren)
+	{
+		culled += child->cull(area, mWorldTransform, moved);
+		changed = changed || child->mBoundsChanged;
+	}
+
+	if (changed)
+	{
+		mCullBounds = mDrawBounds;
+		FOREACH(Ptr& child, mChildren)
+			mCullBounds = unite(mCullBounds, child->mCullBounds);
+	}
+	mBoundsChanged = changed;
+
+	// Subtrees that draw nothing are kept, skipping them wouldn't save anything
+	bool empty = (mCullBounds.width <= 0.f || mCullBounds.height <= 0.f);
+	mCulled = !empty && !mCullBounds.intersects(area);
+
+	// A culled subtree counts once, however many of its descendants are outside too
+	return mCulled ? 1 : culled;
+}
+
 void SceneNode::drawChildren(sf::RenderTarget& target, sf::RenderStates states) const
 {
 	FOREACH(const Ptr& child, mChildren)
@@ -120,7 +224,10 @@ bool SceneNode::isEmpty()
 void SceneNode::pop()
 {
 	if (!mChildren.empty())
+	{
 		mChildren.pop_back();
+		mBoundsDirty = true;
+	}
 }
 
 sf::Vector2f SceneNode::getWorldPosition() const
@@ -133,7 +240,7 @@ sf::Transform SceneNode::getWorldTransform() const
 	sf::Transform transform = sf::Transform::Identity;
 
 	for (const SceneNode* node = this; node != nullptr; node = node->mParent)
-		transform = node->getTransform() * transform;
+		transform = node->getLocalTransform() * transform;
 
 	return transform;
 }
@@ -154,28 +261,15 @@ unsigned int SceneNode::getCategory() const
 	return mDefaultCategory;
 }
 
-void SceneNode::checkSceneCollision(SceneNode& sceneGraph, std::set<Pair>& collisionPairs)
-{
-	checkNodeCollision(sceneGraph, collisionPairs);
-
-	FOREACH(Ptr& child, sceneGraph.mChildren)
-		checkSceneCollision(*child, collisionPairs);
-}
-
-void SceneNode::checkNodeCollision(SceneNode& node, std::set<Pair>& collisionPairs)
-{
-	if (this != &node && collision(*this, node) && !isDestroyed() && !node.isDestroyed())
-		collisionPairs.insert(std::minmax(this, &node));
-
-	FOREACH(Ptr& child, mChildren)
-		child->checkNodeCollision(node, collisionPairs);
-}
-
 void SceneNode::removeWrecks()
 {
 	// Remove all children which request so
 	auto wreckfieldBegin = std::remove_if(mChildren.begin(), mChildren.end(), std::mem_fn(&SceneNode::isMarkedForRemoval));
-	mChildren.erase(wreckfieldBegin, mChildren.end());
+	if (wreckfieldBegin != mChildren.end())
+	{
+		mChildren.erase(wreckfieldBegin, mChildren.end());
+		mBoundsDirty = true;
+	}
 
 	// Call function recursively for all remaining children
 	std::for_each(mChildren.begin(), mChildren.end(), std::mem_fn(&SceneNode::removeWrecks));
@@ -198,11 +292,6 @@ bool SceneNode::isDestroyed() const
 	return false;
 }
 
-bool collision(const SceneNode& lhs, const SceneNode& rhs)
-{
-	return lhs.getBoundingRect().intersects(rhs.getBoundingRect());
-}
-
 float distance(const SceneNode& lhs, const SceneNode& rhs)
 {
 	return length(lhs.getWorldPosition() - rhs.getWorldPosition());
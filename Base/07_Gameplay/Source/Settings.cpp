@@ -0,0 +1,50 @@
+#include <Book/Settings.hpp>
+
+
+namespace
+{
+	const unsigned int TickRates[] = { 30, 60, 120, 240 };
+	const std::size_t TickRateCount = sizeof(TickRates) / sizeof(TickRates[0]);
+
+	const unsigned int RenderRates[] = { 30, 60, 120, 144, 0 };
+	const std::size_t RenderRateCount = sizeof(RenderRates) / sizeof(RenderRates[0]);
+}
+
+Settings::Settings()
+: mTickRateIndex(1)
+, mRenderRateIndex(1)
+{
+}
+
+unsigned int Settings::getTickRate() const
+{
+	return TickRates[mTickRateIndex];
+}
+
+sf::Time Settings::getTimePerTick() const
+{
+	return sf::seconds(1.f / getTickRate());
+}
+
+void Settings::selectNextTickRate()
+{
+	mTickRateIndex = (mTickRateIndex + 1) % TickRateCount;
+}
+
+unsigned int Settings::getRenderRate() const
+{
+	return RenderRates[mRenderRateIndex];
+}
+
+sf::Time Settings::getTimePerRender() const
+{
+	if (getRenderRate() == 0)
+		return sf::Time::Zero;
+
+	return sf::seconds(1.f / getRenderRate());
+}
+
+void Settings::selectNextRenderRate()
+{
+	mRenderRateIndex = (mRenderRateIndex + 1) % RenderRateCount;
+}
@@ -1,6 +1,8 @@
 #include <Book/SettingsState.hpp>
+#include <Book/CountingTarget.hpp>
 #include <Book/Utility.hpp>
 #include <Book/ResourceHolder.hpp>
+#include <Book/Settings.hpp>
 
 #include <SFML/Graphics/RenderWindow.hpp>
 
@@ -35,6 +37,31 @@ SettingsState::SettingsState(StateStack& stack, Context context)
 
 	mGUIContainer.pack(mChangeControlButton);
 
+	// Build button cycling through the simulation tick rates
+	mTickRateButton = std::make_shared<GUI::Button>(*context.fonts, *context.textures, *context.window, context);
+	mTickRateButton->setPosition(420.f, 250.f);
+	mTickRateButton->setText("Tick Rate: " + toString(context.settings->getTickRate()) + " Hz");
+	mTickRateButton->setCallback([this] ()
+	{
+		Settings& settings = *this->getContext().settings;
+		settings.selectNextTickRate();
+		mTickRateButton->setText("Tick Rate: " + toString(settings.getTickRate()) + " Hz");
+	});
+
+	mGUIContainer.pack(mTickRateButton);
+
+	// Build button cycling through the frame rate limits
+	mRenderRateButton = std::make_shared<GUI::Button>(*context.fonts, *context.textures, *context.window, context);
+	mRenderRateButton->setPosition(420.f, 200.f);
+	mRenderRateButton->setCallback([this] ()
+	{
+		this->getContext().settings->selectNextRenderRate();
+		updateRenderRateText();
+	});
+	updateRenderRateText();
+
+	mGUIContainer.pack(mRenderRateButton);
+
 	// Build key binding buttons and labels
 	addControlButtons(context);
 
@@ -49,11 +76,14 @@ SettingsState::SettingsState(StateStack& stack, Context context)
 	backButton->setCallback(std::bind(&SettingsState::requestStackPop, this));	
 	
 	mGUIContainer.pack(backButton);	
+
+	enableDrawOnDemand();
+	setOpaque(true);
 }
 
-void SettingsState::draw()
+void SettingsState::draw(float)
 {
-	sf::RenderWindow& window = *getContext().window;
+	CountingTarget window(*getContext().window, getContext().statistics);
 
 	window.draw(mBackgroundSprite);
 	window.draw(mGUIContainer);
@@ -93,7 +123,8 @@ bool SettingsState::handleEvent(const sf::Event& event)
 		updateLabels();
 	else
 		mGUIContainer.handleEvent(event);
-	
+
+	invalidate();
 	return false;
 }
 
@@ -118,6 +149,16 @@ void SettingsState::addControlButtons(Context& context)
 	addButtonLabel(Player::LaunchEnergy,	600.f, "Energy", context);	
 }
 
+void SettingsState::updateRenderRateText()
+{
+	unsigned int renderRate = getContext().settings->getRenderRate();
+
+	if (renderRate == 0)
+		mRenderRateButton->setText("Frame Rate: Unlimited");
+	else
+		mRenderRateButton->setText("Frame Rate: " + toString(renderRate) + " FPS");
+}
+
 void SettingsState::updateLabels()
 {
 	Player& player = *getContext().player;	
@@ -0,0 +1,100 @@
+#include <Book/SoundEventBuffer.hpp>
+#include <Book/SoundPlayer.hpp>
+
+#include <algorithm>
+
+
+namespace
+{
+	// Effects further outside the view than this are culled. The listener is the player, who may be
+	// anywhere in the 1024x768 view, so a gain threshold either kept everything on screen and far
+	// beyond it, or cut effects still on screen (0.045 at the opposite corner). Culling by the view
+	// instead drops the fire of enemies that have not scrolled in yet, and keeps a margin in which
+	// they can be heard shortly before; the gain there is below 0.1 for most player positions.
+	const float AudibleMargin = 100.f;
+
+	// An effect merges into one of the same kind started within this time and distance
+	const sf::Time MergeWindow = sf::milliseconds(60);
+	const float MergeRadius = 50.f;
+}
+
+SoundEventBuffer::SoundEventBuffer()
+: mPending()
+, mRecent()
+, mCulledCount(0)
+, mMergedCount(0)
+{
+}
+
+void SoundEventBuffer::push(SoundEffect::ID effect, sf::Vector2f position)
+{
+	Event event;
+	event.effect = effect;
+	event.position = position;
+	event.age = sf::Time::Zero;
+
+	mPending.push_back(event);
+}
+
+void SoundEventBuffer::flush(SoundPlayer& player, const sf::FloatRect& viewBounds, sf::Time dt)
+{
+	sf::FloatRect audible(viewBounds.left - AudibleMargin, viewBounds.top - AudibleMargin,
+		viewBounds.width + 2.f * AudibleMargin, viewBounds.height + 2.f * AudibleMargin);
+
+	mCulledCount = 0;
+	mMergedCount = 0;
+
+	// Age the effects started in earlier ticks, forget those out of the merge window
+	for (std::size_t i = 0; i < mRecent.size(); ++i)
+		mRecent[i].age += dt;
+
+	mRecent.erase(std::remove_if(mRecent.begin(), mRecent.end(), [] (const Event& event)
+	{
+		return event.age >= MergeWindow;
+	}), mRecent.end());
+
+	for (std::size_t i = 0; i < mPending.size(); ++i)
+	{
+		const Event& event = mPending[i];
+
+		if (!audible.contains(event.position))
+		{
+			++mCulledCount;
+		}
+		else if (isMerged(event))
+		{
+			++mMergedCount;
+		}
+		else
+		{
+			player.play(event.effect, event.position);
+			mRecent.push_back(event);
+		}
+	}
+
+	mPending.clear();
+}
+
+std::size_t SoundEventBuffer::getCulledCount() const
+{
+	return mCulledCount;
+}
+
+std::size_t SoundEventBuffer::getMergedCount() const
+{
+	return mMergedCount;
+}
+
+bool SoundEventBuffer::isMerged(const Event& event) const
+{
+	for (std::size_t i = 0; i < mRecent.size(); ++i)
+	{
+		const Event& recent = mRecent[i];
+		sf::Vector2f offset = recent.position - event.position;
+
+		if (recent.effect == event.effect && offset.x * offset.x + offset.y * offset.y < MergeRadius * MergeRadius)
+			return true;
+	}
+
+	return false;
+}
@@ -2,6 +2,7 @@
 
 #include <SFML/Audio/Listener.hpp>
 
+#include <algorithm>
 #include <cmath>
 
 
@@ -13,19 +14,53 @@ namespace
 	const float Attenuation = 8.f;
 	const float MinDistance2D = 200.f;
 	const float MinDistance3D = std::sqrt(MinDistance2D*MinDistance2D + ListenerZ*ListenerZ);
+
+	// When the pool is full, an effect may only steal a voice of lower or equal priority
+	const int Priorities[] =
+	{
+		1,	// AlliedGunfire
+		0,	// EnemyGunfire
+		3,	// Explosion1
+		3,	// Explosion2
+		2,	// LaunchMissile
+		2,	// CollectPickup
+		4,	// Button
+	};
+
+	static_assert(sizeof(Priorities) / sizeof(Priorities[0]) == SoundEffect::Count, "Priorities must have one entry per SoundEffect::ID");
+}
+
+const std::size_t SoundPlayer::PoolSize = 32;
+
+SoundPlayer::Voice::Voice()
+: sound()
+, priority(0)
+, active(false)
+{
 }
 
-SoundPlayer::SoundPlayer()
+SoundPlayer::SoundPlayer(const AssetPack& pack, LoadTimeline& timeline)
 : mSoundBuffers()
-, mSounds()
+, mVoices(PoolSize)
+, mMuted(false)
+, mMaxVoices(PoolSize)
+, mActiveVoices(0)
+, mStealCount(0)
+, mDropCount(0)
 {
-	mSoundBuffers.load(SoundEffect::AlliedGunfire,	"Media/Sound/AlliedGunfire.wav");
-	mSoundBuffers.load(SoundEffect::EnemyGunfire,	"Media/Sound/EnemyGunfire.wav");
-	mSoundBuffers.load(SoundEffect::Explosion1,		"Media/Sound/Explosion1.wav");
-	mSoundBuffers.load(SoundEffect::Explosion2,		"Media/Sound/Explosion2.wav");
-	mSoundBuffers.load(SoundEffect::LaunchMissile,	"Media/Sound/LaunchMissile.wav");
-	mSoundBuffers.load(SoundEffect::CollectPickup,	"Media/Sound/CollectPickup.wav");
-	mSoundBuffers.load(SoundEffect::Button,			"Media/Sound/Button.wav");
+	// WAV decoding doesn't need the main thread, so all effects load in parallel
+	SoundBufferHolder::FileList files;
+	files.push_back(std::make_pair(SoundEffect::AlliedGunfire,	"Media/Sound/AlliedGunfire.wav"));
+	files.push_back(std::make_pair(SoundEffect::EnemyGunfire,	"Media/Sound/EnemyGunfire.wav"));
+	files.push_back(std::make_pair(SoundEffect::Explosion1,		"Media/Sound/Explosion1.wav"));
+	files.push_back(std::make_pair(SoundEffect::Explosion2,		"Media/Sound/Explosion2.wav"));
+	files.push_back(std::make_pair(SoundEffect::LaunchMissile,	"Media/Sound/LaunchMissile.wav"));
+	files.push_back(std::make_pair(SoundEffect::CollectPickup,	"Media/Sound/CollectPickup.wav"));
+	files.push_back(std::make_pair(SoundEffect::Button,			"Media/Sound/Button.wav"));
+
+	mSoundBuffers.setPack(pack);
+	mSoundBuffers.loadAll(files, &timeline);
+	mSoundBuffers.checkAllLoaded();
 
 	// Listener points towards the screen (default in SFML)
 	sf::Listener::setDirection(0.f, 0.f, -1.f);
@@ -38,9 +73,25 @@ void SoundPlayer::play(SoundEffect::ID effect)
 
 void SoundPlayer::play(SoundEffect::ID effect, sf::Vector2f position)
 {
-	mSounds.push_back(sf::Sound());
-	sf::Sound& sound = mSounds.back();
+	if (mMuted)
+		return;
+
+	int priority = Priorities[effect];
+	Voice* voice = findVoice(priority);
+	if (!voice)
+	{
+		++mDropCount;
+		return;
+	}
+
+	if (!voice->active)
+		++mActiveVoices;
+
+	voice->priority = priority;
+	voice->active = true;
 
+	sf::Sound& sound = voice->sound;
+	sound.stop();
 	sound.setBuffer(mSoundBuffers.get(effect));
 	sound.setPosition(position.x, -position.y, 0.f);
 	sound.setAttenuation(Attenuation);
@@ -51,10 +102,50 @@ void SoundPlayer::play(SoundEffect::ID effect, sf::Vector2f position)
 
 void SoundPlayer::removeStoppedSounds()
 {
-	mSounds.remove_if([] (const sf::Sound& s)
+	// Only frees voices for reuse, the pool itself never grows or shrinks
+	for (std::size_t i = 0; i < mMaxVoices; ++i)
 	{
-		return s.getStatus() == sf::Sound::Stopped;
-	});
+		Voice& voice = mVoices[i];
+		if (voice.active && voice.sound.getStatus() == sf::Sound::Stopped)
+		{
+			voice.active = false;
+			--mActiveVoices;
+		}
+	}
+}
+
+void SoundPlayer::setMuted(bool muted)
+{
+	if (muted == mMuted)
+		return;
+
+	mMuted = muted;
+	for (std::size_t i = 0; i < mMaxVoices; ++i)
+	{
+		sf::Sound& sound = mVoices[i].sound;
+		if (muted && sound.getStatus() == sf::Sound::Playing)
+			sound.pause();
+		else if (!muted && sound.getStatus() == sf::Sound::Paused)
+			sound.play();
+	}
+}
+
+void SoundPlayer::setMaxVoices(std::size_t maxVoices)
+{
+	maxVoices = std::min(maxVoices, PoolSize);
+
+	for (std::size_t i = maxVoices; i < mMaxVoices; ++i)
+	{
+		Voice& voice = mVoices[i];
+		voice.sound.stop();
+		if (voice.active)
+		{
+			voice.active = false;
+			--mActiveVoices;
+		}
+	}
+
+	mMaxVoices = maxVoices;
 }
 
 void SoundPlayer::setListenerPosition(sf::Vector2f position)
@@ -67,3 +158,63 @@ sf::Vector2f SoundPlayer::getListenerPosition() const
 	sf::Vector3f position = sf::Listener::getPosition();
 	return sf::Vector2f(position.x, -position.y);
 }
+
+float SoundPlayer::getGain(sf::Vector2f position) const
+{
+	// Inverse distance model used by OpenAL, without the volume factor all effects share
+	sf::Vector3f offset = sf::Vector3f(position.x, -position.y, 0.f) - sf::Listener::getPosition();
+	float distance = std::max(std::sqrt(offset.x*offset.x + offset.y*offset.y + offset.z*offset.z), MinDistance3D);
+
+	return MinDistance3D / (MinDistance3D + Attenuation * (distance - MinDistance3D));
+}
+
+std::size_t SoundPlayer::getActiveVoices() const
+{
+	return mActiveVoices;
+}
+
+std::size_t SoundPlayer::getMaxVoices() const
+{
+	return mMaxVoices;
+}
+
+std::size_t SoundPlayer::getStealCount() const
+{
+	return mStealCount;
+}
+
+std::size_t SoundPlayer::getDropCount() const
+{
+	return mDropCount;
+}
+
+SoundPlayer::Voice* SoundPlayer::findVoice(int priority)
+{
+	// Prefer a free voice; otherwise the lowest-priority one, the quietest among equals
+	Voice* victim = nullptr;
+	float victimGain = 0.f;
+
+	for (std::size_t i = 0; i < mMaxVoices; ++i)
+	{
+		Voice& voice = mVoices[i];
+		if (!voice.active || voice.sound.getStatus() == sf::Sound::Stopped)
+			return &voice;
+
+		if (voice.priority > priority)
+			continue;
+
+		sf::Vector3f position = voice.sound.getPosition();
+		float gain = getGain(sf::Vector2f(position.x, -position.y));
+		if (!victim || voice.priority < victim->priority
+			|| (voice.priority == victim->priority && gain < victimGain))
+		{
+			victim = &voice;
+			victimGain = gain;
+		}
+	}
+
+	if (victim)
+		++mStealCount;
+
+	return victim;
+}
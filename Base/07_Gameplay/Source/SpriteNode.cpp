@@ -1,5 +1,7 @@
 #include <Book/SpriteNode.hpp>
 
+#include <Book/RenderQueue.hpp>
+
 #include <SFML/Graphics/RenderTarget.hpp>
 
 
@@ -16,4 +18,14 @@ SpriteNode::SpriteNode(const sf::Texture& texture, const sf::IntRect& textureRec
 void SpriteNode::drawCurrent(sf::RenderTarget& target, sf::RenderStates states) const
 {
 	target.draw(mSprite, states);
-}
\ No newline at end of file
+}
+
+void SpriteNode::enqueueCurrent(RenderQueue& queue, sf::RenderStates states) const
+{
+	queue.submit(mSprite, states, RenderQueue::Background, mSprite.getTexture());
+}
+
+sf::FloatRect SpriteNode::getDrawBounds() const
+{
+	return mSprite.getGlobalBounds();
+}
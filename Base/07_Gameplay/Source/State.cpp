@@ -2,19 +2,29 @@
 #include <Book/StateStack.hpp>
 
 
-State::Context::Context(sf::RenderWindow& window, TextureHolder& textures, FontHolder& fonts, Player& player, MusicPlayer& music, SoundPlayer& sounds)
+State::Context::Context(sf::RenderWindow& window, TextureHolder& textures, FontHolder& fonts, Player& player, MusicPlayer& music, SoundPlayer& sounds, Profiler& profiler, Settings& settings, RenderStatistics& statistics, QualityGovernor& quality, ResolutionScaler& resolution, ResourceBudget& textureBudget, const AssetPack& assets)
 : window(&window)
 , textures(&textures)
 , fonts(&fonts)
 , player(&player)
 , music(&music)
 , sounds(&sounds)
+, profiler(&profiler)
+, settings(&settings)
+, statistics(&statistics)
+, quality(&quality)
+, resolution(&resolution)
+, textureBudget(&textureBudget)
+, assets(&assets)
 {
 }
 
 State::State(StateStack& stack, Context context)
 : mStack(&stack)
 , mContext(context)
+, mDrawOnDemand(false)
+, mDirty(true)
+, mOpaque(false)
 {
 }
 
@@ -22,6 +32,36 @@ State::~State()
 {
 }
 
+bool State::isDirty() const
+{
+	return !mDrawOnDemand || mDirty;
+}
+
+void State::markDrawn()
+{
+	mDirty = false;
+}
+
+bool State::isOpaque() const
+{
+	return mOpaque;
+}
+
+void State::enableDrawOnDemand()
+{
+	mDrawOnDemand = true;
+}
+
+void State::invalidate()
+{
+	mDirty = true;
+}
+
+void State::setOpaque(bool flag)
+{
+	mOpaque = flag;
+}
+
 void State::requestStackPush(States::ID stateID)
 {
 	mStack->pushState(stateID);
@@ -1,14 +1,17 @@
 #include <Book/StateStack.hpp>
 #include <Book/Foreach.hpp>
+#include <Book/RenderStatistics.hpp>
 
 #include <cassert>
 
 
 StateStack::StateStack(State::Context context)
 : mStack()
+, mStackIDs()
 , mPendingList()
 , mContext(context)
 , mFactories()
+, mChanged(true)
 {
 }
 
@@ -24,11 +27,17 @@ void StateStack::update(sf::Time dt)
 	applyPendingChanges();
 }
 
-void StateStack::draw()
+void StateStack::draw(float interpolation)
 {
-	// Draw all active states from bottom to top
-	FOREACH(State::Ptr& state, mStack)
-		state->draw();
+	// Draw visible states from bottom to top; anything below an opaque state is hidden
+	for (std::size_t i = getFirstVisibleState(); i < mStack.size(); ++i)
+	{
+		mContext.statistics->setState(mStackIDs[i]);
+		mStack[i]->draw(interpolation);
+		mStack[i]->markDrawn();
+	}
+
+	mChanged = false;
 }
 
 void StateStack::handleEvent(const sf::Event& event)
@@ -63,6 +72,20 @@ bool StateStack::isEmpty() const
 	return mStack.empty();
 }
 
+bool StateStack::isDirty() const
+{
+	if (mChanged)
+		return true;
+
+	for (std::size_t i = getFirstVisibleState(); i < mStack.size(); ++i)
+	{
+		if (mStack[i]->isDirty())
+			return true;
+	}
+
+	return false;
+}
+
 State::Ptr StateStack::createState(States::ID stateID)
 {
 	auto found = mFactories.find(stateID);
@@ -71,6 +94,17 @@ State::Ptr StateStack::createState(States::ID stateID)
 	return found->second();
 }
 
+std::size_t StateStack::getFirstVisibleState() const
+{
+	for (std::size_t i = mStack.size(); i > 0; --i)
+	{
+		if (mStack[i - 1]->isOpaque())
+			return i - 1;
+	}
+
+	return 0;
+}
+
 void StateStack::applyPendingChanges()
 {
 	FOREACH(PendingChange change, mPendingList)
@@ -79,18 +113,24 @@ void StateStack::applyPendingChanges()
 		{
 			case Push:
 				mStack.push_back(createState(change.stateID));
+				mStackIDs.push_back(change.stateID);
 				break;
 
 			case Pop:
 				mStack.pop_back();
+				mStackIDs.pop_back();
 				break;
 
 			case Clear:
 				mStack.clear();
+				mStackIDs.clear();
 				break;
 		}
 	}
 
+	if (!mPendingList.empty())
+		mChanged = true;
+
 	mPendingList.clear();
 }
 
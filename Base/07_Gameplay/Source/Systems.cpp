@@ -0,0 +1,306 @@
+#include <Book/Systems.hpp>
+#include <Book/EntityRegistry.hpp>
+#include <Book/Entity.hpp>
+#include <Book/Utility.hpp>
+#include <Book/Profiler.hpp>
+#include <Book/Foreach.hpp>
+#include <Book/RenderQueue.hpp>
+#include <Book/Category.hpp>
+
+#include <SFML/Graphics/RenderTarget.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+
+namespace
+{
+	// Distance between the positions at which swept shapes are compared, and the most positions per pair
+	const float SweepStep = 2.f;
+	const int MaxSweepSamples = 16;
+
+	// Candidate pair whose bounding boxes overlap
+	struct BoxContact
+	{
+		std::size_t first;
+		std::size_t second;
+	};
+
+	// Narrows [enter, exit] to the times at which [min, max] moving with the given
+	// velocity overlaps the fixed [otherMin, otherMax]; false if it never does
+	bool clipAxis(float min, float max, float velocity, float otherMin, float otherMax, float& enter, float& exit)
+	{
+		if (velocity == 0.f)
+			return min < otherMax && otherMin < max;
+
+		float first = (otherMin - max) / velocity;
+		float last = (otherMax - min) / velocity;
+		if (first > last)
+			std::swap(first, last);
+
+		enter = std::max(enter, first);
+		exit = std::min(exit, last);
+		return enter < exit;
+	}
+
+	bool shapesOverlap(const EntityRegistry& registry, std::size_t lhs, std::size_t rhs)
+	{
+		const Components::Collider& lhsCollider = registry.getColliders()[lhs];
+		const Components::Collider& rhsCollider = registry.getColliders()[rhs];
+
+		// Without masks on both sides, the bounding box test is final
+		if (!lhsCollider.shape || !rhsCollider.shape)
+			return true;
+
+		const Components::Transform& lhsTransform = registry.getTransforms()[lhs];
+		const Components::Transform& rhsTransform = registry.getTransforms()[rhs];
+		const sf::Sprite& lhsSprite = registry.getSprites()[lhs].sprite;
+		const sf::Sprite& rhsSprite = registry.getSprites()[rhs].sprite;
+
+		return CollisionMask::overlap(
+			*lhsCollider.shape, Systems::computeTextureCenter(lhsTransform, lhsSprite), lhsTransform.rotation + lhsSprite.getRotation(),
+			*rhsCollider.shape, Systems::computeTextureCenter(rhsTransform, rhsSprite), rhsTransform.rotation + rhsSprite.getRotation());
+	}
+
+	// Continuous test over the last tick: both entities move linearly from their previous
+	// to their current position. The boxes give the time interval in which the pair can touch
+	// (swept AABB), the pixel masks are then compared at a few positions inside that interval.
+	bool sweptShapesOverlap(const EntityRegistry& registry, std::size_t lhs, std::size_t rhs)
+	{
+		const Components::Transform& lhsTransform = registry.getTransforms()[lhs];
+		const Components::Transform& rhsTransform = registry.getTransforms()[rhs];
+		const Components::Sprite& lhsSprite = registry.getSprites()[lhs];
+		const Components::Sprite& rhsSprite = registry.getSprites()[rhs];
+
+		sf::Vector2f lhsDelta = lhsTransform.position - lhsTransform.previousPosition;
+		sf::Vector2f rhsDelta = rhsTransform.position - rhsTransform.previousPosition;
+		sf::Vector2f relative = lhsDelta - rhsDelta;
+
+		// Boxes at the start of the tick; lhs moves relative to rhs
+		sf::FloatRect lhsBox = Systems::computeBoundingRect(lhsTransform, lhsSprite);
+		sf::FloatRect rhsBox = Systems::computeBoundingRect(rhsTransform, rhsSprite);
+		lhsBox.left -= lhsDelta.x;
+		lhsBox.top -= lhsDelta.y;
+		rhsBox.left -= rhsDelta.x;
+		rhsBox.top -= rhsDelta.y;
+
+		float enter = 0.f;
+		float exit = 1.f;
+		if (!clipAxis(lhsBox.left, lhsBox.left + lhsBox.width, relative.x, rhsBox.left, rhsBox.left + rhsBox.width, enter, exit)
+			|| !clipAxis(lhsBox.top, lhsBox.top + lhsBox.height, relative.y, rhsBox.top, rhsBox.top + rhsBox.height, enter, exit))
+			return false;
+
+		const Components::Collider& lhsCollider = registry.getColliders()[lhs];
+		const Components::Collider& rhsCollider = registry.getColliders()[rhs];
+		if (!lhsCollider.shape || !rhsCollider.shape)
+			return true;
+
+		sf::Vector2f lhsCenter = Systems::computeTextureCenter(lhsTransform, lhsSprite.sprite) - lhsDelta;
+		sf::Vector2f rhsCenter = Systems::computeTextureCenter(rhsTransform, rhsSprite.sprite) - rhsDelta;
+		float lhsRotation = lhsTransform.rotation + lhsSprite.sprite.getRotation();
+		float rhsRotation = rhsTransform.rotation + rhsSprite.sprite.getRotation();
+
+		float distance = length(relative) * (exit - enter);
+		int samples = std::min(MaxSweepSamples, 1 + static_cast<int>(std::ceil(distance / SweepStep)));
+
+		for (int i = 0; i < samples; ++i)
+		{
+			float time = enter + (exit - enter) * (i + 0.5f) / samples;
+			if (CollisionMask::overlap(*lhsCollider.shape, lhsCenter + lhsDelta * time, lhsRotation,
+				*rhsCollider.shape, rhsCenter + rhsDelta * time, rhsRotation))
+				return true;
+		}
+
+		return false;
+	}
+
+	// Overlap order of entity sprites: pickups below aircraft, the player above enemies, projectiles on top
+	sf::Uint32 getDepth(unsigned int category)
+	{
+		if (category & Category::Pickup)
+			return 0;
+		if (category & (Category::EnemyAircraft | Category::AlliedAircraft))
+			return 1;
+		if (category & Category::PlayerAircraft)
+			return 2;
+		return 3;
+	}
+}
+
+namespace Systems
+{
+
+sf::FloatRect computeBoundingRect(const Components::Transform& transform, const Components::Sprite& sprite)
+{
+	// Entities live in untransformed scene layers, so their local transform is their world transform
+	sf::Transform world;
+	world.translate(transform.position).rotate(transform.rotation);
+
+	return world.transformRect(sprite.sprite.getGlobalBounds());
+}
+
+sf::Vector2f interpolatePosition(const Components::Transform& transform, float interpolation)
+{
+	return transform.previousPosition + (transform.position - transform.previousPosition) * interpolation;
+}
+
+sf::Vector2f computeTextureCenter(const Components::Transform& transform, const sf::Sprite& sprite)
+{
+	sf::Transform world;
+	world.translate(transform.position).rotate(transform.rotation);
+	world *= sprite.getTransform();
+
+	sf::IntRect rect = sprite.getTextureRect();
+	return world.transformPoint(rect.width / 2.f, rect.height / 2.f);
+}
+
+void updateMovementPatterns(EntityRegistry& registry, sf::Time dt)
+{
+	ComponentArray<Components::MovementPattern>& patterns = registry.getMovementPatterns();
+	std::vector<Components::Velocity>& velocities = registry.getVelocities();
+	const std::vector<Components::Hitpoints>& hitpoints = registry.getHitpoints();
+
+	for (std::size_t i = 0; i < patterns.size(); ++i)
+	{
+		Components::MovementPattern& pattern = patterns.at(i);
+		std::size_t index = registry.indexOf(patterns.getOwner(i));
+
+		if (hitpoints[index].value <= 0)
+			continue;
+
+		// Moved long enough in current direction: Change direction
+		const std::vector<Direction>& directions = *pattern.directions;
+		if (pattern.travelledDistance > directions[pattern.directionIndex].distance)
+		{
+			pattern.directionIndex = (pattern.directionIndex + 1) % directions.size();
+			pattern.travelledDistance = 0.f;
+		}
+
+		// Compute velocity from direction
+		float radians = toRadian(directions[pattern.directionIndex].angle + 90.f);
+		velocities[index].value = sf::Vector2f(pattern.speed * std::cos(radians), pattern.speed * std::sin(radians));
+
+		pattern.travelledDistance += pattern.speed * dt.asSeconds();
+	}
+}
+
+void integrateVelocities(EntityRegistry& registry, sf::Time dt)
+{
+	std::vector<Components::Transform>& transforms = registry.getTransforms();
+	const std::vector<Components::Velocity>& velocities = registry.getVelocities();
+	const std::vector<Components::Hitpoints>& hitpoints = registry.getHitpoints();
+
+	for (std::size_t i = 0; i < transforms.size(); ++i)
+	{
+		Components::Transform& transform = transforms[i];
+		transform.previousPosition = transform.position;
+
+		// Wrecks stay where they were destroyed
+		if (hitpoints[i].value <= 0)
+			continue;
+
+		transform.position += velocities[i].value * dt.asSeconds();
+	}
+}
+
+void updateColliders(EntityRegistry& registry)
+{
+	const std::vector<Components::Transform>& transforms = registry.getTransforms();
+	const std::vector<Components::Sprite>& sprites = registry.getSprites();
+	const std::vector<Components::Collider>& colliders = registry.getColliders();
+	const std::vector<Components::Hitpoints>& hitpoints = registry.getHitpoints();
+
+	BoundingBoxArray& boxes = registry.getBoundingBoxes();
+	boxes.resize(colliders.size());
+
+	// Compute every box once per tick; wrecks get no category, so nothing collides with them
+	for (std::size_t i = 0; i < colliders.size(); ++i)
+	{
+		bool alive = hitpoints[i].value > 0;
+		sf::FloatRect bounds = computeBoundingRect(transforms[i], sprites[i]);
+
+		// Swept colliders cover their whole path of the last tick, so the broad phase can't skip a target
+		if (Collision::isSwept(colliders[i].category))
+		{
+			sf::Vector2f delta = transforms[i].position - transforms[i].previousPosition;
+			bounds = unite(bounds, sf::FloatRect(bounds.left - delta.x, bounds.top - delta.y, bounds.width, bounds.height));
+		}
+
+		boxes.set(i, bounds, alive ? colliders[i].category : 0u, alive ? colliders[i].mask : 0u);
+	}
+}
+
+void findCollisions(const EntityRegistry& registry, std::vector<Collision::Contact>& contacts, Profiler& profiler)
+{
+	const BoundingBoxArray& boxes = registry.getBoundingBoxes();
+	std::vector<BoxContact> boxContacts;
+
+	for (std::size_t i = 0; i < boxes.size(); ++i)
+	{
+		if (boxes.getMask(i) == 0)
+			continue;
+
+		// Layer and overlap test against a batch of boxes at once, the batch
+		// masks out pairs that never interact (enemy-enemy, bullet-bullet...)
+		for (std::size_t first = i + 1; first < boxes.size(); first += BoundingBoxArray::BatchSize)
+		{
+			unsigned int hits = boxes.overlapBatch(i, first);
+			for (std::size_t j = first; hits != 0; ++j, hits >>= 1)
+			{
+				if (hits & 1u)
+				{
+					BoxContact contact = { i, j };
+					boxContacts.push_back(contact);
+				}
+			}
+		}
+	}
+
+	// Narrow phase: rotated sprites rarely fill their bounding boxes, so confirm
+	// the pairs on their pixel masks. Timed as a whole to keep the clock out of the loop,
+	// and reported per candidate pair tested, which does not depend on how many hit.
+	std::size_t confirmed = contacts.size();
+	Profiler::Stopwatch stopwatch;
+	FOREACH(const BoxContact& pair, boxContacts)
+	{
+		bool swept = Collision::isSwept(boxes.getCategory(pair.first)) || Collision::isSwept(boxes.getCategory(pair.second));
+
+		if (swept ? sweptShapesOverlap(registry, pair.first, pair.second) : shapesOverlap(registry, pair.first, pair.second))
+			contacts.push_back(Collision::makeContact(registry.getFacade(pair.first), boxes.getCategory(pair.first),
+				registry.getFacade(pair.second), boxes.getCategory(pair.second)));
+	}
+
+	profiler.recordNanoseconds("Pixel test", stopwatch.getElapsedNanoseconds(), boxContacts.size());
+	profiler.count("Pixel test hits", contacts.size() - confirmed);
+}
+
+std::size_t enqueueSprites(const EntityRegistry& registry, RenderQueue& queue, const sf::FloatRect& area)
+{
+	const std::vector<Components::Transform>& transforms = registry.getTransforms();
+	const std::vector<Components::Sprite>& sprites = registry.getSprites();
+	const std::vector<Components::Collider>& colliders = registry.getColliders();
+	float interpolation = registry.getInterpolation();
+	std::size_t culled = 0;
+
+	for (std::size_t i = 0; i < sprites.size(); ++i)
+	{
+		Components::Transform drawn = transforms[i];
+		drawn.position = interpolatePosition(transforms[i], interpolation);
+
+		// Skip sprites outside the area, e.g. enemies waiting above the view
+		if (!computeBoundingRect(drawn, sprites[i]).intersects(area))
+		{
+			++culled;
+			continue;
+		}
+
+		sf::RenderStates states;
+		states.transform.translate(drawn.position).rotate(drawn.rotation);
+
+		queue.submit(sprites[i].sprite, states, RenderQueue::Entities, sprites[i].sprite.getTexture(), getDepth(colliders[i].category));
+	}
+
+	return culled;
+}
+
+}
@@ -5,6 +5,9 @@
 
     
 TextNode::TextNode(const FontHolder& fonts, const std::string& text)
+: mText()
+, mBounds()
+, mLayer(RenderQueue::Overlay)
 {
 	mText.setFont(fonts.get(Fonts::Main));
 	mText.setCharacterSize(20);
@@ -18,6 +21,30 @@ void TextNode::drawCurrent(sf::RenderTarget& target, sf::RenderStates states) co
 
 void TextNode::setString(const std::string& text)
 {
+	// Displays set their string every tick, mostly to the same value
+	if (text == mText.getString())
+		return;
+
 	mText.setString(text);
 	centerOrigin(mText);
+
+	// Glyph layout only changes with the string, so the bounds are computed here rather than per frame
+	mBounds = mText.getGlobalBounds();
+	invalidateBounds();
+}
+
+void TextNode::setLayer(RenderQueue::Layer layer)
+{
+	mLayer = layer;
+}
+
+void TextNode::enqueueCurrent(RenderQueue& queue, sf::RenderStates states) const
+{
+	// Texts of one size share the glyph page of the font
+	queue.submit(mText, states, mLayer, &mText.getFont()->getTexture(mText.getCharacterSize()));
+}
+
+sf::FloatRect TextNode::getDrawBounds() const
+{
+	return mBounds;
 }
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include <Book/TitleState.hpp>
+#include <Book/CountingTarget.hpp>
 #include <Book/Utility.hpp>
 #include <Book/ResourceHolder.hpp>
 
@@ -17,11 +18,14 @@ TitleState::TitleState(StateStack& stack, Context context)
 	mText.setString("Press any key to start");
 	centerOrigin(mText);
 	mText.setPosition(sf::Vector2f(context.window->getSize() / 2u));
+
+	enableDrawOnDemand();
+	setOpaque(true);
 }
 
-void TitleState::draw()
+void TitleState::draw(float)
 {
-	sf::RenderWindow& window = *getContext().window;
+	CountingTarget window(*getContext().window, getContext().statistics);
 	window.draw(mBackgroundSprite);
 
 	if (mShowText)
@@ -36,6 +40,7 @@ bool TitleState::update(sf::Time dt)
 	{
 		mShowText = !mShowText;
 		mTextEffectTime = sf::Time::Zero;
+		invalidate();
 	}
 
 	return true;
@@ -3,6 +3,7 @@
 #include <SFML/Graphics/Sprite.hpp>
 #include <SFML/Graphics/Text.hpp>
 
+#include <algorithm>
 #include <random>
 #include <cmath>
 #include <ctime>
@@ -170,4 +171,19 @@ sf::Vector2f unitVector(sf::Vector2f vector)
 {
 	assert(vector != sf::Vector2f(0.f, 0.f));
 	return vector / length(vector);
-}
\ No newline at end of file
+}
+
+sf::FloatRect unite(const sf::FloatRect& lhs, const sf::FloatRect& rhs)
+{
+	if (lhs.width <= 0.f || lhs.height <= 0.f)
+		return rhs;
+	if (rhs.width <= 0.f || rhs.height <= 0.f)
+		return lhs;
+
+	float left = std::min(lhs.left, rhs.left);
+	float top = std::min(lhs.top, rhs.top);
+	float right = std::max(lhs.left + lhs.width, rhs.left + rhs.width);
+	float bottom = std::max(lhs.top + lhs.height, rhs.top + rhs.height);
+
+	return sf::FloatRect(left, top, right - left, bottom - top);
+}